@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the pointer-based binary intrusive_heap with the array-based intrusive_dary_heap.
+// For each size the benchmark pushes that many nodes with random keys, pops all of them, and
+// erases all of them in random order after pushing them again.
+//
+// Usage: example.benchmark.intrusive_heaps [max size]
+
+#include <exec/__detail/intrusive_dary_heap.hpp>
+#include <exec/__detail/intrusive_heap.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+  struct node {
+    std::uint64_t key = 0;
+    node* prev = nullptr;
+    node* left = nullptr;
+    node* right = nullptr;
+    std::size_t index = 0;
+  };
+
+  using binary_heap = exec::intrusive_heap<&node::key, &node::prev, &node::left, &node::right>;
+  using dary_heap = exec::intrusive_dary_heap<&node::key, &node::index>;
+
+  struct timings {
+    double push;
+    double pop;
+    double erase;
+  };
+
+  template <class Heap>
+  auto measure(std::vector<node>& nodes, const std::vector<std::size_t>& erase_order) -> timings {
+    std::mt19937_64 rng{nodes.size()};
+    auto assign_keys = [&] {
+      for (node& n: nodes) {
+        n.key = rng() | 1; // intrusive_heap::erase() reserves the key zero
+      }
+    };
+    auto per_op = [&](auto start, auto end) {
+      return std::chrono::duration<double, std::nano>(end - start).count()
+           / static_cast<double>(nodes.size());
+    };
+    Heap heap{};
+    timings result{};
+
+    assign_keys();
+    auto start = std::chrono::steady_clock::now();
+    for (node& n: nodes) {
+      heap.insert(&n);
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.push = per_op(start, end);
+
+    start = std::chrono::steady_clock::now();
+    std::uint64_t previous = 0;
+    while (node* n = heap.front()) {
+      if (n->key < previous) {
+        std::cerr << "heap order violated\n";
+        std::abort();
+      }
+      previous = n->key;
+      heap.pop_front();
+    }
+    end = std::chrono::steady_clock::now();
+    result.pop = per_op(start, end);
+
+    assign_keys();
+    for (node& n: nodes) {
+      heap.insert(&n);
+    }
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i: erase_order) {
+      heap.erase(&nodes[i]);
+    }
+    end = std::chrono::steady_clock::now();
+    result.erase = per_op(start, end);
+    if (heap.front() != nullptr) {
+      std::cerr << "heap not empty after erasing all nodes\n";
+      std::abort();
+    }
+    return result;
+  }
+
+  void print(const char* name, std::size_t size, const timings& t) {
+    std::cout << std::setw(10) << size << "  " << std::setw(11) << name << std::fixed
+              << std::setprecision(1) << "  push " << std::setw(7) << t.push << " ns"
+              << "  pop " << std::setw(7) << t.pop << " ns"
+              << "  erase " << std::setw(7) << t.erase << " ns\n";
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+  for (std::size_t size = 1'000; size <= max_size; size *= 10) {
+    std::vector<node> nodes(size);
+    std::vector<std::size_t> erase_order(size);
+    std::iota(erase_order.begin(), erase_order.end(), std::size_t{0});
+    std::shuffle(erase_order.begin(), erase_order.end(), std::mt19937_64{42});
+    print("binary heap", size, measure<binary_heap>(nodes, erase_order));
+    print("4-ary heap", size, measure<dary_heap>(nodes, erase_order));
+  }
+}
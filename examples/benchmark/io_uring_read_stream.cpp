@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Streams a file through io_uring_read_stream and checksums the chunks on a thread pool while
+// the next reads are in flight.
+//
+// Usage: example.benchmark.io_uring_read_stream [file] [buffer size in KiB] [max buffers]
+//
+// Without a file argument a temporary file of 256 MiB is created. Note that a file that is
+// already in the page cache measures the copy bandwidth rather than the device bandwidth.
+
+#include <exec/linux/io_uring_read_stream.hpp>
+#include <exec/sequence/ignore_all_values.hpp>
+#include <exec/sequence/transform_each.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <stdexec/execution.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-bench-XXXXXX"};
+
+    explicit temp_file(std::size_t size) {
+      int fd = ::mkstemp(path.data());
+      std::vector<char> block(1 << 20);
+      for (std::size_t i = 0; i < block.size(); ++i) {
+        block[i] = static_cast<char>(i * 7);
+      }
+      for (std::size_t written = 0; written < size; written += block.size()) {
+        if (::write(fd, block.data(), block.size()) < 0) {
+          std::abort();
+        }
+      }
+      ::close(fd);
+    }
+
+    ~temp_file() {
+      ::unlink(path.data());
+    }
+  };
+
+  auto checksum(std::span<const std::byte> chunk) noexcept -> std::uint64_t {
+    std::uint64_t sum = 0;
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= chunk.size(); i += sizeof(std::uint64_t)) {
+      std::uint64_t word;
+      std::memcpy(&word, chunk.data() + i, sizeof(word));
+      sum += word;
+    }
+    for (; i < chunk.size(); ++i) {
+      sum += static_cast<std::uint64_t>(chunk[i]);
+    }
+    return sum;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  std::unique_ptr<temp_file> tmp{};
+  std::string path{};
+  if (argc > 1) {
+    path = argv[1];
+  } else {
+    tmp = std::make_unique<temp_file>(std::size_t{256} << 20);
+    path = tmp->path.data();
+  }
+  const std::size_t buffer_size = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 256) << 10;
+  const std::size_t max_buffers = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 16;
+
+  exec::io_uring_context context{};
+  std::thread io_thread{[&] { context.run_until_stopped(); }};
+  exec::static_thread_pool pool{};
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    std::cerr << "cannot open " << path << "\n";
+    return 1;
+  }
+  struct ::stat st {};
+  ::fstat(fd, &st);
+  const auto file_size = static_cast<double>(st.st_size);
+
+  std::cout << "file size: " << st.st_size << " bytes, buffer size: " << buffer_size
+            << " bytes\n";
+  for (std::size_t n_buffers = 1; n_buffers <= max_buffers; n_buffers *= 2) {
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    std::atomic<std::uint64_t> sum{0};
+    auto start = std::chrono::steady_clock::now();
+    stdexec::sync_wait(exec::ignore_all_values(
+      exec::io_uring_read_stream(context.get_scheduler(), fd, buffer_size, n_buffers)
+      | exec::transform_each(
+        stdexec::continue_on(pool.get_scheduler())
+        | stdexec::then([&](std::span<const std::byte> chunk) {
+            sum.fetch_add(checksum(chunk), std::memory_order_relaxed);
+          }))));
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> seconds = end - start;
+    std::cout << "buffers: " << n_buffers << ", " << file_size / seconds.count() / 1e9
+              << " GB/s (checksum " << sum.load() << ")\n";
+  }
+
+  ::close(fd);
+  context.request_stop();
+  io_thread.join();
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Sends a file over a loopback tcp connection, once with io_uring_transfer_file and once with
+// a loop of io_uring_read and io_uring_write through a user space buffer.
+//
+// Usage: example.benchmark.io_uring_transfer_file [file] [chunk size in KiB] [repetitions]
+//
+// Without a file argument a temporary file of 256 MiB is created.
+
+#include <exec/linux/io_uring_transfer_file.hpp>
+#include <stdexec/execution.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-bench-XXXXXX"};
+
+    explicit temp_file(std::size_t size) {
+      int fd = ::mkstemp(path.data());
+      std::vector<char> block(1 << 20);
+      for (std::size_t i = 0; i < block.size(); ++i) {
+        block[i] = static_cast<char>(i * 7);
+      }
+      for (std::size_t written = 0; written < size; written += block.size()) {
+        if (::write(fd, block.data(), block.size()) < 0) {
+          std::abort();
+        }
+      }
+      ::close(fd);
+    }
+
+    ~temp_file() {
+      ::unlink(path.data());
+    }
+  };
+
+  // A connected pair of tcp sockets on the loopback interface.
+  struct tcp_pair {
+    int client = -1;
+    int server = -1;
+
+    tcp_pair() {
+      int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+      ::sockaddr_in address{};
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      ::socklen_t length = sizeof(address);
+      ::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+      ::listen(listener, 1);
+      ::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length);
+      client = ::socket(AF_INET, SOCK_STREAM, 0);
+      ::connect(client, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+      server = ::accept(listener, nullptr, nullptr);
+      ::close(listener);
+    }
+
+    ~tcp_pair() {
+      ::close(client);
+      ::close(server);
+    }
+  };
+
+  // Sends the file through a user space buffer.
+  auto read_and_send(
+    exec::io_uring_scheduler sched,
+    int fd,
+    int socket,
+    std::size_t size,
+    std::vector<std::byte>& buffer) -> std::size_t {
+    std::size_t sent = 0;
+    while (sent < size) {
+      std::span<std::byte> chunk = std::span{buffer}.first(std::min(buffer.size(), size - sent));
+      auto offset = static_cast<::off_t>(sent);
+      auto [n_read] = stdexec::sync_wait(exec::io_uring_read(sched, fd, chunk, offset)).value();
+      if (n_read == 0) {
+        break;
+      }
+      for (std::size_t n_written = 0; n_written < n_read;) {
+        auto pending = std::span{buffer}.subspan(n_written, n_read - n_written);
+        auto [n] = stdexec::sync_wait(exec::io_uring_write(sched, socket, pending)).value();
+        n_written += n;
+      }
+      sent += n_read;
+    }
+    return sent;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  std::unique_ptr<temp_file> tmp{};
+  std::string path{};
+  if (argc > 1) {
+    path = argv[1];
+  } else {
+    tmp = std::make_unique<temp_file>(std::size_t{256} << 20);
+    path = tmp->path.data();
+  }
+  const std::size_t chunk_size = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 256) << 10;
+  const int repetitions = argc > 3 ? std::atoi(argv[3]) : 5;
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    std::cerr << "cannot open " << path << "\n";
+    return 1;
+  }
+
+  exec::io_uring_context context{};
+  std::thread io_thread{[&] { context.run_until_stopped(); }};
+  exec::io_uring_scheduler sched = context.get_scheduler();
+
+  struct ::stat st {};
+  ::fstat(fd, &st);
+  const auto size = static_cast<std::size_t>(st.st_size);
+  std::vector<std::byte> buffer(chunk_size);
+
+  auto run = [&](const char* name, auto transfer) {
+    tcp_pair sockets;
+    std::thread reader{[&] {
+      std::vector<char> sink(1 << 20);
+      for (std::size_t received = 0; received < size * repetitions;) {
+        ssize_t n = ::read(sockets.server, sink.data(), sink.size());
+        if (n <= 0) {
+          break;
+        }
+        received += static_cast<std::size_t>(n);
+      }
+    }};
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+      if (transfer(sockets.client) != size) {
+        std::cerr << name << ": short transfer\n";
+        std::abort();
+      }
+    }
+    reader.join();
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> seconds = end - start;
+    std::cout << name << ": "
+              << static_cast<double>(size) * repetitions / seconds.count() / 1e9 << " GB/s\n";
+  };
+
+  std::cout << "file size: " << size << " bytes, chunk size: " << chunk_size << " bytes\n";
+  run("read + send", [&](int socket) {
+    return read_and_send(sched, fd, socket, size, buffer);
+  });
+  run("transfer_file", [&](int socket) {
+    auto [n] =
+      stdexec::sync_wait(exec::io_uring_transfer_file(sched, fd, socket, 0, size, chunk_size))
+        .value();
+    return n;
+  });
+
+  ::close(fd);
+  context.request_stop();
+  io_thread.join();
+}
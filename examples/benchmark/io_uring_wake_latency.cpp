@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how long it takes until the thread that drives an io_uring_context runs a task
+// that another thread has scheduled on it. Compares a blocking driver, a driver that spins
+// before it blocks and a driver that polls for completions.
+//
+// Usage: example.benchmark.io_uring_wake_latency [iterations] [pause between tasks in us]
+
+#include <exec/linux/io_uring_context.hpp>
+#include <stdexec/execution.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+  struct percentiles {
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds max;
+  };
+
+  auto measure(
+    const exec::io_uring_context_options& options,
+    std::size_t iterations,
+    std::chrono::microseconds pause) -> percentiles {
+    exec::io_uring_context context{options};
+    std::thread io_thread{[&] { context.run_until_stopped(); }};
+    std::vector<std::chrono::nanoseconds> latencies{};
+    latencies.reserve(iterations);
+    for (std::size_t i = 0; i < iterations; ++i) {
+      // Give the driving thread time to become idle again.
+      std::this_thread::sleep_for(pause);
+      auto start = std::chrono::steady_clock::now();
+      auto [woken] = stdexec::sync_wait(
+                       stdexec::schedule(context.get_scheduler())
+                       | stdexec::then([] { return std::chrono::steady_clock::now(); }))
+                       .value();
+      latencies.push_back(woken - start);
+    }
+    context.request_stop();
+    io_thread.join();
+    std::sort(latencies.begin(), latencies.end());
+    return {
+      latencies[latencies.size() / 2],
+      latencies[latencies.size() * 99 / 100],
+      latencies.back()};
+  }
+
+  void report(const char* name, const percentiles& result) {
+    std::cout << name << ": p50 " << result.p50.count() << " ns, p99 " << result.p99.count()
+              << " ns, max " << result.max.count() << " ns\n";
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000;
+  const std::chrono::microseconds pause{argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20};
+
+  report("blocking", measure({}, iterations, pause));
+  report("busy poll 100us", measure({.busy_poll = 100us}, iterations, pause));
+  try {
+    report("io poll", measure({.io_poll = true}, iterations, pause));
+  } catch (const std::system_error& e) {
+    std::cout << "io poll: not supported (" << e.what() << ")\n";
+  }
+}
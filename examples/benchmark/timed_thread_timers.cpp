@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Starts many timeouts on a timed_thread_context and cancels most of them before they expire,
+// like the timeouts of requests that complete in time. Compares the timer stores of the
+// context. With "expire" as the third argument, all timers expire right away instead, which
+// measures the context thread without any other thread cancelling timers.
+//
+// Usage: example.benchmark.timed_thread_timers [timers] [cancelled per mille] [expire]
+
+#include <exec/timed_thread_scheduler.hpp>
+#include <stdexec/execution.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+  struct timer;
+
+  struct timer_receiver {
+    using receiver_concept = stdexec::receiver_t;
+    timer* timer_;
+
+    void set_value() noexcept;
+    void set_stopped() noexcept;
+    auto get_env() const noexcept
+      -> stdexec::prop<stdexec::get_stop_token_t, stdexec::inplace_stop_token>;
+  };
+
+  using timer_operation =
+    stdexec::connect_result_t<exec::timed_thread_scheduler::schedule_at, timer_receiver>;
+
+  struct timer {
+    stdexec::inplace_stop_source stop_source{};
+    std::optional<timer_operation> operation{};
+    std::atomic<std::size_t>* n_completed = nullptr;
+  };
+
+  void timer_receiver::set_value() noexcept {
+    timer_->n_completed->fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void timer_receiver::set_stopped() noexcept {
+    timer_->n_completed->fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto timer_receiver::get_env() const noexcept
+    -> stdexec::prop<stdexec::get_stop_token_t, stdexec::inplace_stop_token> {
+    return stdexec::prop{stdexec::get_stop_token, timer_->stop_source.get_token()};
+  }
+
+  void measure(
+    const char* name,
+    const exec::timed_thread_context_options& options,
+    std::size_t n_timers,
+    std::size_t cancelled_per_mille,
+    bool expire) {
+    auto timers = std::make_unique<timer[]>(n_timers);
+    std::atomic<std::size_t> n_completed{0};
+    std::size_t n_cancelled = 0;
+    exec::timed_thread_context context{options};
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n_timers; ++i) {
+      timer& t = timers[i];
+      t.n_completed = &n_completed;
+      // Timeouts between 10 and 30 seconds, which none of the timers reaches, unless they
+      // expire right away.
+      auto deadline = start;
+      if (!expire) {
+        deadline += 10s + std::chrono::milliseconds((i * 7919) % 20'000);
+      }
+      t.operation.emplace(stdexec::__emplace_from{[&] {
+        return stdexec::connect(exec::schedule_at(scheduler, deadline), timer_receiver{&t});
+      }});
+      stdexec::start(*t.operation);
+    }
+    for (std::size_t i = 0; !expire && i < n_timers; ++i) {
+      if (i % 1000 < cancelled_per_mille) {
+        timers[i].stop_source.request_stop();
+        ++n_cancelled;
+      }
+    }
+    const std::size_t n_expected = expire ? n_timers : n_cancelled;
+    while (n_completed.load(std::memory_order_relaxed) < n_expected) {
+      std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double> seconds = end - start;
+    std::cout << name << ": " << static_cast<double>(n_timers) / seconds.count() / 1e6
+              << " M timers/s (" << n_cancelled << " cancelled)\n";
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  const std::size_t n_timers = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+  const std::size_t cancelled_per_mille = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 990;
+  const bool expire = argc > 3 && std::strcmp(argv[3], "expire") == 0;
+  measure(
+    "heap ",
+    {.timer_store = exec::timed_thread_timer_store::heap},
+    n_timers,
+    cancelled_per_mille,
+    expire);
+  measure(
+    "dary ",
+    {.timer_store = exec::timed_thread_timer_store::dary_heap},
+    n_timers,
+    cancelled_per_mille,
+    expire);
+  measure(
+    "wheel",
+    {.timer_store = exec::timed_thread_timer_store::wheel},
+    n_timers,
+    cancelled_per_mille,
+    expire);
+}
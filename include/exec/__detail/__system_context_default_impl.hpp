@@ -18,6 +18,27 @@
 #include "__system_context_replaceability_api.hpp"
 #include "stdexec/execution.hpp"
 #include "exec/static_thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// The default backend provides a system-wide io_uring context where io_uring is available.
+#if !defined(STDEXEC_SYSTEM_CONTEXT_IO_URING)
+#  if defined(__linux__) && __has_include(<linux/io_uring.h>) && __has_include(<linux/version.h>)
+#    define STDEXEC_SYSTEM_CONTEXT_IO_URING 1
+#  else
+#    define STDEXEC_SYSTEM_CONTEXT_IO_URING 0
+#  endif
+#endif
+
+#if STDEXEC_SYSTEM_CONTEXT_IO_URING
+#  include "exec/linux/io_uring_context.hpp"
+#endif
 
 namespace exec::__system_context_default_impl {
   using namespace stdexec::tags;
@@ -25,6 +46,11 @@ namespace exec::__system_context_default_impl {
   using system_context_replaceability::bulk_item_receiver;
   using system_context_replaceability::storage;
   using system_context_replaceability::system_scheduler;
+  using system_context_replaceability::system_scheduler_with_hints;
+  using system_context_replaceability::schedule_hints;
+  using system_context_replaceability::storage_requirements;
+  using system_context_replaceability::system_scheduler_storage;
+  using system_context_replaceability::system_io_context;
   using system_context_replaceability::__system_context_replaceability;
 
   using __pool_scheduler_t = decltype(std::declval<exec::static_thread_pool>().get_scheduler());
@@ -39,23 +65,75 @@ namespace exec::__system_context_default_impl {
   schedule:
   - __recv::__r_ (receiver*) -- 8
   - __recv::__op_ (__operation*) -- 8
-  - __operation::__inner_op_ (stdexec::connect_result_t<_Sender, __recv<_Sender>>) -- 56 (when connected with an empty receiver)
-  - __operation::__on_heap_ (bool) -- optimized away
+  - __operation::__inner_op_ (stdexec::connect_result_t<_Sender, __recv<_Sender>>) -- 48 (when connected with an empty receiver)
+  - __operation::__blocks_ (__block_pool*) -- 8
   ---------------------
-  Total: 72; extra 16 bytes compared to internal operation state.
-
-  extra for bulk:
-  - __recv::__r_ (receiver*) -- 8
-  - __recv::__op_ (__operation*) -- 8
-  - __operation::__inner_op_ (stdexec::connect_result_t<_Sender, __recv<_Sender>>) -- 128 (when connected with an empty receiver & fun)
-  - __operation::__on_heap_ (bool) -- optimized away
-  - __bulk_functor::__r_ (bulk_item_receiver*) - 8
+  Total: 72; extra 24 bytes compared to internal operation state. With libnuma, the inner
+  operation state also records a NUMA node, which makes 80.
+
+  bulk:
+  - __bulk_state::__r_ (bulk_item_receiver*) -- 8
+  - __bulk_state::__impl_ (__system_scheduler_impl*) -- 8
+  - __bulk_state::__chunks_ (__bulk_chunk*) -- 8
+  - __bulk_state::__n_chunks_, __remaining_ (uint32_t) -- 8
+  - __bulk_state::__blocks_ (__block_pool*) -- 8
+  - __bulk_state::__failed_ (atomic_flag) -- 8 (with padding)
+  - __bulk_state::__error_ (exception_ptr) -- 8
   ---------------------
-  Total: 152; extra 24 bytes compared to internal operation state.
+  Total: 56. The chunks are taken from a pool of the backend.
+
+  The backend publishes these sizes through `system_scheduler_storage`. Operations that do not
+  fit in the storage given by the frontend are placed in blocks that the backend recycles.
 
-  [*] sizes taken on an Apple M2 Pro arm64 arch. They may differ on other architectures, or with different implementations.
+  [*] sizes taken on x86-64 with libstdc++. They may differ on other architectures, or with different implementations.
   */
 
+  /// Recycles fixed-size blocks of memory for operations that do not fit in the storage given by
+  /// the frontend. Only allocates while the number of such operations in flight grows.
+  class __block_pool {
+    struct __free_block {
+      __free_block* __next_;
+    };
+
+   public:
+    __block_pool(size_t __size, size_t __alignment) noexcept
+      : __size_{std::max(__size, sizeof(__free_block))}
+      , __alignment_{std::max(__alignment, alignof(__free_block))} {
+    }
+
+    __block_pool(const __block_pool&) = delete;
+    __block_pool& operator=(const __block_pool&) = delete;
+
+    ~__block_pool() {
+      while (__free_ != nullptr) {
+        ::operator delete(std::exchange(__free_, __free_->__next_), std::align_val_t{__alignment_});
+      }
+    }
+
+    /// Returns a block of the size and alignment of the pool; throws if it needs to allocate and
+    /// cannot.
+    void* __allocate() {
+      {
+        std::lock_guard __lock{__mutex_};
+        if (__free_ != nullptr) {
+          return std::exchange(__free_, __free_->__next_);
+        }
+      }
+      return ::operator new(__size_, std::align_val_t{__alignment_});
+    }
+
+    void __deallocate(void* __block) noexcept {
+      std::lock_guard __lock{__mutex_};
+      __free_ = ::new (__block) __free_block{__free_};
+    }
+
+   private:
+    size_t __size_;
+    size_t __alignment_;
+    std::mutex __mutex_;
+    __free_block* __free_{nullptr};
+  };
+
   template <class _Sender>
   struct __recv {
     using receiver_concept = stdexec::receiver_t;
@@ -106,22 +184,47 @@ namespace exec::__system_context_default_impl {
     }
   }
 
+  /// Constructs a `_Tp` from `__args` in `__storage` if it fits, and in a block of `__blocks`
+  /// otherwise; `_Tp` keeps the pool of its block, or `nullptr`.
+  template <class _Tp, class... _Args>
+  _Tp* __construct_in(storage __storage, __block_pool& __blocks, _Args&&... __args) {
+    __storage = __ensure_alignment(__storage, alignof(_Tp));
+    if (__storage.__data != nullptr && __storage.__size >= sizeof(_Tp)) {
+      return ::new (__storage.__data) _Tp(static_cast<_Args&&>(__args)..., nullptr);
+    }
+    void* __block = __blocks.__allocate();
+    try {
+      return ::new (__block) _Tp(static_cast<_Args&&>(__args)..., &__blocks);
+    } catch (...) {
+      __blocks.__deallocate(__block);
+      throw;
+    }
+  }
+
+  /// Destroys `__p`, which was constructed by `__construct_in`, and gives back its block.
+  template <class _Tp>
+  void __destroy_in(_Tp* __p) noexcept {
+    __block_pool* __blocks = __p->__blocks_;
+    std::destroy_at(__p);
+    if (__blocks != nullptr) {
+      __blocks->__deallocate(__p);
+    }
+  }
+
   template <typename _Sender>
   struct __operation {
     /// The inner operation state, that results out of connecting the underlying sender with the receiver.
     stdexec::connect_result_t<_Sender, __recv<_Sender>> __inner_op_;
-    /// True if the operation is on the heap, false if it is in the preallocated space.
-    bool __on_heap_;
-
-    /// Try to construct the operation in the preallocated memory if it fits, otherwise allocate a new operation.
-    static __operation*
-      __construct_maybe_alloc(storage __storage, receiver* __completion, _Sender __sndr) {
-      __storage = __ensure_alignment(__storage, alignof(__operation));
-      if (__storage.__data == nullptr || __storage.__size < sizeof(__operation)) {
-        return new __operation(std::move(__sndr), __completion, true);
-      } else {
-        return new (__storage.__data) __operation(std::move(__sndr), __completion, false);
-      }
+    /// The pool of the block the operation is in; `nullptr` if it is in the preallocated space.
+    __block_pool* __blocks_;
+
+    /// Constructs the operation in the preallocated memory if it fits, otherwise in a block of `__blocks`.
+    static __operation* __construct_maybe_alloc(
+      storage __storage,
+      __block_pool& __blocks,
+      receiver* __completion,
+      _Sender __sndr) {
+      return __construct_in<__operation>(__storage, __blocks, std::move(__sndr), __completion);
     }
 
     //! Starts the operation that will schedule work on the system scheduler.
@@ -129,54 +232,251 @@ namespace exec::__system_context_default_impl {
       stdexec::start(__inner_op_);
     }
 
-    /// Destructs the operation; frees any allocated memory.
+    /// Destructs the operation; gives back the block it is in, if any.
     void __destruct() {
-      if (__on_heap_) {
-        delete this;
-      } else {
-        std::destroy_at(this);
-      }
+      __destroy_in(this);
     }
 
-   private:
-    __operation(_Sender __sndr, receiver* __completion, bool __on_heap)
+    __operation(_Sender __sndr, receiver* __completion, __block_pool* __blocks)
       : __inner_op_(stdexec::connect(std::move(__sndr), __recv<_Sender>{__completion, this}))
-      , __on_heap_(__on_heap) {
+      , __blocks_(__blocks) {
     }
   };
 
-  struct __system_scheduler_impl : system_scheduler {
+  /// Work scheduled with hints that waits in the priority queues of the backend.
+  /// Placed in the storage given by the frontend, if it fits.
+  struct __queued_task {
+    __queued_task(receiver* __r, __block_pool* __blocks) noexcept
+      : __r_{__r}
+      , __blocks_{__blocks} {
+    }
+
+    receiver* __r_;
+    __queued_task* __next_{nullptr};
+    /// The pool of the block the task is in; `nullptr` if it is in the preallocated space.
+    __block_pool* __blocks_;
+
+    /// Destroys the task and sends the completion signal to the frontend.
+    void __run() noexcept {
+      auto __r = __r_;
+      __destroy_in(this);
+      __r->set_value();
+    }
+  };
+
+  struct __system_scheduler_impl
+    : system_scheduler_with_hints
+    , system_scheduler_storage {
     __system_scheduler_impl()
       : __pool_scheduler_(__pool_.get_scheduler()) {
+      const uint32_t __n_threads = __pool_.available_parallelism();
+      __drainers_ = std::make_unique<std::optional<__drain_operation_t>[]>(__n_threads);
+      __bulk_chunk_blocks_.emplace(sizeof(__bulk_chunk) * __n_threads, alignof(__bulk_chunk));
+      __idle_drainers_.reserve(__n_threads);
+      for (uint32_t __i = 0; __i < __n_threads; ++__i) {
+        __idle_drainers_.push_back(__i);
+      }
     }
    private:
+    //! Receiver for the pool operations that drain the priority queues.
+    struct __drain_receiver {
+      using receiver_concept = stdexec::receiver_t;
+
+      __system_scheduler_impl* __self_;
+      uint32_t __index_;
+
+      void set_value() noexcept {
+        __self_->__drain(__index_);
+      }
+
+      void set_stopped() noexcept {
+        __self_->__drain(__index_);
+      }
+    };
+
+    using __drain_operation_t = stdexec::connect_result_t<
+      decltype(stdexec::schedule(std::declval<__pool_scheduler_t>())),
+      __drain_receiver>;
+
+    /// Number of urgency levels of work with hints. Each priority is split by latency sensitivity
+    /// and expected duration, so that short work does not wait behind long work of the same
+    /// priority.
+    static constexpr size_t __n_levels = 3 * 4;
+
+    static size_t __level_of(const schedule_hints& __hints) noexcept {
+      using __duration = schedule_hints::duration_class;
+      size_t __rank = 0;
+      if (__hints.latency_sensitive) {
+        __rank = 3;
+      } else if (__hints.expected_duration == __duration::short_running) {
+        __rank = 2;
+      } else if (__hints.expected_duration == __duration::unknown) {
+        __rank = 1;
+      }
+      return static_cast<size_t>(__hints.priority) * 4 + __rank;
+    }
+
+    // The queues are declared before the pool, so that the pool threads are joined before the
+    // queues and the drain operations are destroyed.
+
+    /// Queues of work with hints, one per urgency level.
+    std::mutex __queues_mutex_;
+    stdexec::__intrusive_queue<&__queued_task::__next_> __queues_[__n_levels];
+    /// One drain operation per pool thread; each takes the most urgent work from the queues until
+    /// they are empty.
+    std::unique_ptr<std::optional<__drain_operation_t>[]> __drainers_;
+    std::vector<uint32_t> __idle_drainers_;
+
+    /// Blocks for the operations that do not fit in the storage given by the frontend.
+    __block_pool __schedule_blocks_{
+      sizeof(__schedule_operation_t),
+      alignof(__schedule_operation_t)};
+    __block_pool __queued_task_blocks_{sizeof(__queued_task), alignof(__queued_task)};
+    __block_pool __bulk_blocks_{sizeof(__bulk_state), alignof(__bulk_state)};
+    /// Blocks for the chunks of bulk operations; each has room for one chunk per pool thread.
+    std::optional<__block_pool> __bulk_chunk_blocks_;
+
     /// The underlying thread pool.
     exec::static_thread_pool __pool_;
     __pool_scheduler_t __pool_scheduler_;
 
-    //! Functor called by the `bulk` operation; sends a `start` signal to the frontend.
-    struct __bulk_functor {
-      bulk_item_receiver* __r_;
+    void __enqueue(__queued_task* __task, const schedule_hints& __hints) noexcept {
+      std::optional<uint32_t> __drainer;
+      {
+        std::lock_guard __lock{__queues_mutex_};
+        __queues_[__level_of(__hints)].push_back(__task);
+        if (!__idle_drainers_.empty()) {
+          __drainer = __idle_drainers_.back();
+          __idle_drainers_.pop_back();
+        }
+      }
+      if (__drainer) {
+        auto& __op = __drainers_[*__drainer].emplace(stdexec::__emplace_from{[&]() noexcept {
+          return stdexec::connect(
+            stdexec::schedule(__pool_scheduler_), __drain_receiver{this, *__drainer});
+        }});
+        stdexec::start(__op);
+      }
+    }
 
-      void operator()(unsigned long __idx) const noexcept {
-        __r_->start(static_cast<uint32_t>(__idx));
+    /// Returns the most urgent queued task, or marks the drainer as idle if there is none.
+    __queued_task* __dequeue_or_idle(uint32_t __drainer) noexcept {
+      std::lock_guard __lock{__queues_mutex_};
+      for (size_t __level = __n_levels; __level-- > 0;) {
+        if (!__queues_[__level].empty()) {
+          return __queues_[__level].pop_front();
+        }
       }
-    };
+      // Cannot allocate: the vector has room for all drainers.
+      __idle_drainers_.push_back(__drainer);
+      return nullptr;
+    }
+
+    void __drain(uint32_t __drainer) noexcept {
+      // Once the drainer is idle, its operation may be replaced by another thread; do not touch
+      // it after that.
+      while (__queued_task* __task = __dequeue_or_idle(__drainer)) {
+        __task->__run();
+      }
+    }
+
+    /// Returns the sender that starts work on the thread or NUMA node preferred by `__hints`.
+    auto __schedule_affine(const schedule_hints& __hints) noexcept {
+      if (__hints.cpu >= 0) {
+        return stdexec::schedule(__pool_.get_scheduler_on_thread(
+          static_cast<size_t>(__hints.cpu) % __pool_.available_parallelism()));
+      }
+      // The sender copies the mask.
+      exec::nodemask __mask{};
+      __mask.set(static_cast<size_t>(__hints.numa_node));
+      return stdexec::schedule(__pool_.get_constrained_scheduler(&__mask));
+    }
 
     using __schedule_operation_t =
       __operation<decltype(stdexec::schedule(std::declval<__pool_scheduler_t>()))>;
 
-    using __bulk_schedule_operation_t = __operation<decltype(stdexec::bulk(
-      stdexec::schedule(std::declval<__pool_scheduler_t>()),
-      std::declval<uint32_t>(),
-      std::declval<__bulk_functor>()))>;
+    struct __bulk_state;
+
+    //! A chunk of a bulk operation, scheduled as work of its own.
+    struct __bulk_chunk : receiver {
+      __bulk_state* __bulk_;
+      uint32_t __begin_;
+      uint32_t __end_;
+      //! Storage for scheduling the chunk, with or without hints.
+      alignas(__schedule_operation_t) alignas(__queued_task) unsigned char
+        __storage_[std::max(sizeof(__schedule_operation_t), sizeof(__queued_task))];
+
+      void set_value() noexcept override {
+        __bulk_->__r_->start(__begin_, __end_);
+        __bulk_->__chunk_done();
+      }
+
+      void set_error(std::exception_ptr __ptr) noexcept override {
+        if (!__bulk_->__failed_.test_and_set(std::memory_order_relaxed)) {
+          __bulk_->__error_ = std::move(__ptr);
+        }
+        __bulk_->__chunk_done();
+      }
+
+      void set_stopped() noexcept override {
+        __bulk_->__stopped_.store(true, std::memory_order_relaxed);
+        __bulk_->__chunk_done();
+      }
+    };
+
+    //! The state of a bulk operation; completes the frontend when the last chunk is done.
+    struct __bulk_state {
+      __bulk_state(
+        bulk_item_receiver* __r,
+        __system_scheduler_impl* __impl,
+        __bulk_chunk* __chunks,
+        uint32_t __n_chunks,
+        __block_pool* __blocks) noexcept
+        : __r_{__r}
+        , __impl_{__impl}
+        , __chunks_{__chunks}
+        , __n_chunks_{__n_chunks}
+        , __remaining_{__n_chunks}
+        , __blocks_{__blocks} {
+      }
+
+      bulk_item_receiver* __r_;
+      __system_scheduler_impl* __impl_;
+      __bulk_chunk* __chunks_;
+      uint32_t __n_chunks_;
+      std::atomic<uint32_t> __remaining_;
+      /// The pool of the block the state is in; `nullptr` if it is in the preallocated space.
+      __block_pool* __blocks_;
+      std::atomic_flag __failed_{};
+      std::exception_ptr __error_{};
+      //! Set if a chunk was stopped instead of running its items.
+      std::atomic<bool> __stopped_{false};
+
+      void __chunk_done() noexcept {
+        if (__remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          auto __r = __r_;
+          auto __error = std::move(__error_);
+          const bool __stopped = __stopped_.load(std::memory_order_relaxed);
+          std::destroy_n(__chunks_, __n_chunks_);
+          __impl_->__bulk_chunk_blocks_->__deallocate(__chunks_);
+          __destroy_in(this);
+          if (__error) {
+            __r->set_error(std::move(__error));
+          } else if (__stopped) {
+            __r->set_stopped();
+          } else {
+            __r->set_value();
+          }
+        }
+      }
+    };
 
    public:
     void schedule(storage __storage, receiver* __r) noexcept override {
       try {
         auto __sndr = stdexec::schedule(__pool_scheduler_);
-        auto __os =
-          __schedule_operation_t::__construct_maybe_alloc(__storage, __r, std::move(__sndr));
+        auto __os = __schedule_operation_t::__construct_maybe_alloc(
+          __storage, __schedule_blocks_, __r, std::move(__sndr));
         __os->start();
       } catch (std::exception& __e) {
         __r->set_error(std::current_exception());
@@ -185,17 +485,111 @@ namespace exec::__system_context_default_impl {
 
     void
       bulk_schedule(uint32_t __size, storage __storage, bulk_item_receiver* __r) noexcept override {
+      __system_scheduler_impl::bulk_schedule(__size, __storage, __r, schedule_hints{});
+    }
+
+    /// Work pinned to a CPU or a NUMA node goes directly to the pool threads it may run on; this
+    /// backend maps CPUs to pool threads by index. Other work with hints waits in the priority
+    /// queues, from which the pool threads take the most urgent work first.
+    void
+      schedule(storage __storage, receiver* __r, const schedule_hints& __hints) noexcept override {
+      if (__hints == schedule_hints{}) {
+        __system_scheduler_impl::schedule(__storage, __r);
+        return;
+      }
       try {
-        auto __sndr =
-          stdexec::bulk(stdexec::schedule(__pool_scheduler_), __size, __bulk_functor{__r});
-        auto __os =
-          __bulk_schedule_operation_t::__construct_maybe_alloc(__storage, __r, std::move(__sndr));
-        __os->start();
+        if (__hints.cpu >= 0 || __hints.numa_node >= 0) {
+          auto __os = __schedule_operation_t::__construct_maybe_alloc(
+            __storage, __schedule_blocks_, __r, __schedule_affine(__hints));
+          __os->start();
+        } else {
+          __enqueue(__construct_in<__queued_task>(__storage, __queued_task_blocks_, __r), __hints);
+        }
       } catch (std::exception& __e) {
         __r->set_error(std::current_exception());
       }
     }
+
+    /// Splits the work into one chunk per pool thread, and schedules each chunk with `__hints`.
+    /// All chunks of work pinned to a CPU run on the same thread, so there is only one.
+    void bulk_schedule(
+      uint32_t __size,
+      storage __storage,
+      bulk_item_receiver* __r,
+      const schedule_hints& __hints) noexcept override {
+      if (__size == 0) {
+        __r->set_value();
+        return;
+      }
+      uint32_t __n_chunks =
+        __hints.cpu >= 0 ? 1 : std::min(__size, __pool_.available_parallelism());
+      __bulk_state* __bulk = nullptr;
+      try {
+        auto* __chunks = static_cast<__bulk_chunk*>(__bulk_chunk_blocks_->__allocate());
+        try {
+          __bulk = __construct_in<__bulk_state>(
+            __storage, __bulk_blocks_, __r, this, __chunks, __n_chunks);
+        } catch (...) {
+          __bulk_chunk_blocks_->__deallocate(__chunks);
+          throw;
+        }
+      } catch (std::exception& __e) {
+        __r->set_error(std::current_exception());
+        return;
+      }
+      for (uint32_t __i = 0; __i < __n_chunks; ++__i) {
+        __bulk_chunk* __chunk = ::new (__bulk->__chunks_ + __i) __bulk_chunk{};
+        __chunk->__bulk_ = __bulk;
+        __chunk->__begin_ = static_cast<uint32_t>(uint64_t(__size) * __i / __n_chunks);
+        __chunk->__end_ = static_cast<uint32_t>(uint64_t(__size) * (__i + 1) / __n_chunks);
+      }
+      // The last chunk may destroy `__bulk`. The scheduling functions are called non-virtually,
+      // so that derived backends do not see the chunks as work of their own.
+      auto __chunks = __bulk->__chunks_;
+      for (uint32_t __i = 0; __i < __n_chunks; ++__i) {
+        storage __chunk_storage{__chunks[__i].__storage_, sizeof(__chunks[__i].__storage_)};
+        __system_scheduler_impl::schedule(__chunk_storage, &__chunks[__i], __hints);
+      }
+    }
+
+    storage_requirements schedule_storage() const noexcept override {
+      return {
+        static_cast<uint32_t>(std::max(sizeof(__schedule_operation_t), sizeof(__queued_task))),
+        static_cast<uint32_t>(std::max(alignof(__schedule_operation_t), alignof(__queued_task)))};
+    }
+
+    storage_requirements bulk_schedule_storage() const noexcept override {
+      return {
+        static_cast<uint32_t>(sizeof(__bulk_state)),
+        static_cast<uint32_t>(alignof(__bulk_state))};
+    }
+  };
+
+#if STDEXEC_SYSTEM_CONTEXT_IO_URING
+  /// Drives one io_uring context on a thread of its own, for the I/O of the whole process.
+  struct __system_io_context_impl : system_io_context {
+    __system_io_context_impl()
+      : __thread_{[this] { __context_.run_until_stopped(); }} {
+    }
+
+    ~__system_io_context_impl() override {
+      __context_.request_stop();
+      __thread_.join();
+    }
+
+    __uuid io_context_id() const noexcept override {
+      return system_context_replaceability::io_context_identifier<exec::io_uring_context>::value;
+    }
+
+    void* get_io_context() noexcept override {
+      return &__context_;
+    }
+
+   private:
+    exec::io_uring_context __context_{};
+    std::thread __thread_;
   };
+#endif
 
   /// Keeps track of the object implementing the system context interfaces.
   struct __instance_holder {
@@ -211,31 +605,101 @@ namespace exec::__system_context_default_impl {
       return __current_instance_;
     }
 
+    /// Get the interface through which the current system context object takes hints, if any.
+    system_scheduler_with_hints* __get_current_hints_instance() const noexcept {
+      return __current_hints_instance_;
+    }
+
+    /// Get the interface through which the current system context object publishes its storage
+    /// needs, if any.
+    system_scheduler_storage* __get_current_storage_instance() const noexcept {
+      return __current_storage_instance_;
+    }
+
     /// Allows changing the currently selected system context object; used for testing.
-    void __set_current_instance(system_scheduler* __instance) noexcept {
+    void __set_current_instance(
+      system_scheduler* __instance,
+      system_scheduler_with_hints* __hints_instance,
+      system_scheduler_storage* __storage_instance) noexcept {
       __current_instance_ = __instance;
+      __current_hints_instance_ = __hints_instance;
+      __current_storage_instance_ = __storage_instance;
+    }
+
+    /// Get the currently selected system I/O context object, if there is one.
+    system_io_context* __get_current_io_instance() const noexcept {
+      return __io_instance_replaced_ ? __current_io_instance_ : __default_io_instance();
+    }
+
+    /// Allows changing the currently selected system I/O context object; used for testing.
+    void __set_current_io_instance(system_io_context* __instance) noexcept {
+      __current_io_instance_ = __instance;
+      __io_instance_replaced_ = true;
     }
 
    private:
     __instance_holder() {
       static __system_scheduler_impl __default_instance_;
-      __current_instance_ = &__default_instance_;
+      __set_current_instance(&__default_instance_, &__default_instance_, &__default_instance_);
+    }
+
+    // The I/O thread is only started once someone asks for the I/O context. Without a usable
+    // io_uring, e.g. in a sandbox that forbids it, there is no system I/O context.
+    static system_io_context* __default_io_instance() noexcept {
+#if STDEXEC_SYSTEM_CONTEXT_IO_URING
+      static system_io_context* __instance = []() noexcept -> system_io_context* {
+        try {
+          static __system_io_context_impl __default_io_instance_;
+          return &__default_io_instance_;
+        } catch (...) {
+          return nullptr;
+        }
+      }();
+      return __instance;
+#else
+      return nullptr;
+#endif
     }
 
     system_scheduler* __current_instance_;
+    system_scheduler_with_hints* __current_hints_instance_;
+    system_scheduler_storage* __current_storage_instance_;
+    system_io_context* __current_io_instance_{nullptr};
+    bool __io_instance_replaced_{false};
   };
 
   struct __system_context_replaceability_impl : __system_context_replaceability {
     //! Globally replaces the system scheduler backend.
     //! This needs to be called within `main()` and before the system scheduler is accessed.
     void __set_system_scheduler(system_scheduler* __backend) noexcept override {
-      __instance_holder::__singleton().__set_current_instance(__backend);
+      __instance_holder::__singleton().__set_current_instance(__backend, nullptr, nullptr);
+    }
+
+    //! Globally replaces the system scheduler backend, together with its optional interfaces.
+    //! This needs to be called within `main()` and before the system scheduler is accessed.
+    void __set_system_scheduler(
+      system_scheduler* __backend,
+      system_scheduler_with_hints* __hints,
+      system_scheduler_storage* __storage) noexcept override {
+      __instance_holder::__singleton().__set_current_instance(__backend, __hints, __storage);
+    }
+
+    //! Globally replaces the system I/O backend; a null pointer removes it.
+    //! This needs to be called within `main()` and before the system I/O context is accessed.
+    void __set_system_io_context(system_io_context* __backend) noexcept override {
+      __instance_holder::__singleton().__set_current_io_instance(__backend);
     }
   };
 
   void* __default_query_system_context_interface(const __uuid& __id) noexcept {
     if (__id == system_scheduler::__interface_identifier) {
       return __instance_holder::__singleton().__get_current_instance();
+    } else if (__id == system_scheduler_with_hints::__interface_identifier) {
+      return __instance_holder::__singleton().__get_current_hints_instance();
+    } else if (__id == system_scheduler_storage::__interface_identifier) {
+      return __instance_holder::__singleton().__get_current_storage_instance();
+    } else if (__id == system_io_context::__interface_identifier) {
+      return __instance_holder::__singleton().__get_current_io_instance();
     } else if (__id == __system_context_replaceability::__interface_identifier) {
       static __system_context_replaceability_impl __impl;
       return &__impl;
@@ -63,9 +63,15 @@ namespace exec::system_context_replaceability {
   };
 
   /// Receiver for bulk sheduling operations.
+  /// The backend hands out the items of a bulk operation either one at a time or in chunks; each
+  /// item must be handed out exactly once.
   struct bulk_item_receiver : receiver {
     /// Called for each item of a bulk operation, possible on different threads.
     virtual void start(uint32_t) noexcept = 0;
+    /// Called for each chunk `[__begin, __end)` of items of a bulk operation, possibly on
+    /// different threads. The frontend runs the items of a chunk in a loop, which saves a virtual
+    /// call per item.
+    virtual void start(uint32_t __begin, uint32_t __end) noexcept = 0;
   };
 
   /// Describes a storage space.
@@ -76,24 +82,132 @@ namespace exec::system_context_replaceability {
   };
 
   /// Interface for the system scheduler
+  ///
+  /// Version 2 added the chunk callback to `bulk_item_receiver`.
   struct system_scheduler {
-    static constexpr __uuid __interface_identifier{0x5ee9202498c4bd4f, 0xa1df2508ffcd9d7e};
+    static constexpr __uuid __interface_identifier{0x5ee9202498c4bd4f, 0xa1df2508ffcd9d7f};
 
     virtual ~system_scheduler() = default;
 
     /// Schedule work on system scheduler, calling `__r` when done and using `__s` for preallocated memory.
     virtual void schedule(storage __s, receiver* __r) noexcept = 0;
-    /// Schedule bulk work of size `__n` on system scheduler, calling `__r` for each item and then when done, and using `__s` for preallocated memory.
+    /// Schedule bulk work of size `__n` on system scheduler, calling `__r` for each item or chunk of items and then when done, and using `__s` for preallocated memory.
     virtual void bulk_schedule(uint32_t __n, storage __s, bulk_item_receiver* __r) noexcept = 0;
   };
 
+  /// Hints on how work scheduled on the system scheduler should run.
+  /// Backends may ignore any of them; a default-constructed object carries no hints.
+  struct schedule_hints {
+    /// How urgent the work is compared to other work with hints.
+    enum class priority_level : uint8_t {
+      low,
+      normal,
+      high
+    };
+
+    /// How long the work is expected to run.
+    enum class duration_class : uint8_t {
+      unknown,
+      short_running,
+      long_running
+    };
+
+    priority_level priority = priority_level::normal;
+    /// True if someone is waiting for the work to start, e.g. to respond to an event.
+    bool latency_sensitive = false;
+    duration_class expected_duration = duration_class::unknown;
+    /// The NUMA node the work prefers to run on, or -1 for any node.
+    int32_t numa_node = -1;
+    /// The CPU the work prefers to run on, or -1 for any CPU; takes precedence over `numa_node`.
+    int32_t cpu = -1;
+
+    friend bool operator==(const schedule_hints&, const schedule_hints&) noexcept = default;
+  };
+
+  /// Interface for a system scheduler that also takes scheduling hints.
+  /// The hints are only valid for the duration of the call.
+  struct system_scheduler_with_hints : system_scheduler {
+    static constexpr __uuid __interface_identifier{0x3c1a7b5e9f08d246, 0x8e52d0c4a61f7b93};
+
+    using system_scheduler::schedule;
+    using system_scheduler::bulk_schedule;
+
+    /// Schedule work on system scheduler as `schedule(__s, __r)` does, taking `__h` into account.
+    virtual void schedule(storage __s, receiver* __r, const schedule_hints& __h) noexcept = 0;
+    /// Schedule bulk work on system scheduler as `bulk_schedule(__n, __s, __r)` does, taking `__h` into account.
+    virtual void bulk_schedule(
+      uint32_t __n,
+      storage __s,
+      bulk_item_receiver* __r,
+      const schedule_hints& __h) noexcept = 0;
+  };
+
+  /// Describes the storage space that a backend needs for an operation.
+  struct storage_requirements {
+    uint32_t __size;
+    uint32_t __alignment;
+  };
+
+  /// Interface through which a system scheduler backend publishes the storage it needs for its
+  /// operations. A backend given storage that satisfies these requirements does not allocate.
+  struct system_scheduler_storage {
+    static constexpr __uuid __interface_identifier{0x94d2e6a0b3c71f58, 0xc7a40f2e915b6d38};
+
+    virtual ~system_scheduler_storage() = default;
+
+    /// The storage needed by `schedule`, with or without hints.
+    virtual storage_requirements schedule_storage() const noexcept = 0;
+    /// The storage needed by `bulk_schedule`, with or without hints.
+    virtual storage_requirements bulk_schedule_storage() const noexcept = 0;
+  };
+
+  /// Identifies an I/O context type that a system I/O backend can provide.
+  /// Specialize it with a `static constexpr __uuid value` for each such type.
+  template <class _Context>
+  struct io_context_identifier { };
+
+  //! Concept for an I/O context type with an `io_context_identifier`.
+  template <typename _Context>
+  concept __identified_io_context =
+    requires() { typename __check_constexpr_uuid<io_context_identifier<_Context>::value>; };
+
+  /// Interface for a system-wide I/O backend.
+  /// Libraries issue asynchronous I/O against the context it provides, instead of running I/O
+  /// threads of their own.
+  ///
+  /// Version 2 identifies the context type by `io_context_identifier`.
+  struct system_io_context {
+    static constexpr __uuid __interface_identifier{0x3d8a61f0c27e94b5, 0xe5c1b79a04f2d863};
+
+    virtual ~system_io_context() = default;
+
+    /// The `io_context_identifier` of the context returned by `get_io_context`.
+    virtual __uuid io_context_id() const noexcept = 0;
+    /// The I/O context. The backend drives it until the end of the program.
+    virtual void* get_io_context() noexcept = 0;
+  };
+
   /// Implementation-defined mechanism for replacing the system scheduler backend at run-time.
+  ///
+  /// Version 2 added `__set_system_io_context`.
+  /// Version 3 added `__set_system_scheduler` with the optional interfaces of the backend.
   struct __system_context_replaceability {
-    static constexpr __uuid __interface_identifier{0xc008a3be3bb9284b, 0xb98edb3a740ee02c};
+    static constexpr __uuid __interface_identifier{0x5a90e3c7f1b46d28, 0x2c6b8f04a9d3e751};
 
-    /// Globally replaces the system scheduler backend.
+    /// Globally replaces the system scheduler backend with one that takes no hints and does not
+    /// publish its storage needs.
     /// This needs to be called within `main()` and before the system scheduler is accessed.
     virtual void __set_system_scheduler(system_scheduler*) noexcept = 0;
+    /// Globally replaces the system scheduler backend, together with the interfaces through which
+    /// it takes hints and publishes its storage needs; either of them may be a null pointer.
+    /// This needs to be called within `main()` and before the system scheduler is accessed.
+    virtual void __set_system_scheduler(
+      system_scheduler*,
+      system_scheduler_with_hints*,
+      system_scheduler_storage*) noexcept = 0;
+    /// Globally replaces the system I/O backend; a null pointer removes it.
+    /// This needs to be called within `main()` and before the system I/O context is accessed.
+    virtual void __set_system_io_context(system_io_context*) noexcept = 0;
   };
 
 } // namespace exec::system_context_replaceability
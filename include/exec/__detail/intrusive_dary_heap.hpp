@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace exec {
+  template <auto Key, auto Index, std::size_t Arity = 4>
+  class intrusive_dary_heap;
+
+  // A d-ary min-heap of node pointers that is stored in an array. Each entry keeps a copy of the
+  // key next to the node pointer, so that sifting compares adjacent entries instead of chasing
+  // pointers to the nodes. Each node stores its position in the array, which lets erase() find
+  // it in constant time.
+  //
+  // The key of a node must not change while the node is in the heap. Unlike intrusive_heap this
+  // heap allocates: insert() throws std::bad_alloc if the array cannot grow. Use reserve() to
+  // allocate up front.
+  template <class Node, class KeyT, KeyT Node::*Key, std::size_t Node::*Index, std::size_t Arity>
+  class intrusive_dary_heap<Key, Index, Arity> {
+    static_assert(Arity >= 2);
+
+   public:
+    void insert(Node* node) {
+      entries_.push_back(entry{node->*Key, node});
+      sift_up(entries_.size() - 1);
+    }
+
+    void pop_front() noexcept {
+      if (!entries_.empty()) {
+        remove_at(0);
+      }
+    }
+
+    Node* front() const noexcept {
+      return entries_.empty() ? nullptr : entries_.front().node;
+    }
+
+    bool erase(Node* node) noexcept {
+      const std::size_t index = node->*Index;
+      if (index >= entries_.size() || entries_[index].node != node) {
+        // node is not in the heap
+        return false;
+      }
+      remove_at(index);
+      return true;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return entries_.empty();
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return entries_.size();
+    }
+
+    void reserve(std::size_t capacity) {
+      entries_.reserve(capacity);
+    }
+
+   private:
+    struct entry {
+      KeyT key;
+      Node* node;
+    };
+
+    std::vector<entry> entries_;
+
+    void move_to(std::size_t index, const entry& e) noexcept {
+      entries_[index] = e;
+      e.node->*Index = index;
+    }
+
+    void remove_at(std::size_t index) noexcept {
+      const entry last = entries_.back();
+      entries_.pop_back();
+      if (index == entries_.size()) {
+        return;
+      }
+      move_to(index, last);
+      if (index > 0 && last.key < entries_[(index - 1) / Arity].key) {
+        sift_up(index);
+      } else {
+        sift_down(index);
+      }
+    }
+
+    void sift_up(std::size_t index) noexcept {
+      const entry e = entries_[index];
+      while (index > 0) {
+        const std::size_t parent = (index - 1) / Arity;
+        if (!(e.key < entries_[parent].key)) {
+          break;
+        }
+        move_to(index, entries_[parent]);
+        index = parent;
+      }
+      move_to(index, e);
+    }
+
+    void sift_down(std::size_t index) noexcept {
+      const entry e = entries_[index];
+      const std::size_t size = entries_.size();
+      while (true) {
+        const std::size_t first = index * Arity + 1;
+        if (first >= size) {
+          break;
+        }
+        const std::size_t last = std::min(first + Arity, size);
+        std::size_t child = first;
+        for (std::size_t i = first + 1; i < last; ++i) {
+          if (entries_[i].key < entries_[child].key) {
+            child = i;
+          }
+        }
+        if (!(entries_[child].key < e.key)) {
+          break;
+        }
+        move_to(index, entries_[child]);
+        index = child;
+      }
+      move_to(index, e);
+    }
+  };
+} // namespace exec
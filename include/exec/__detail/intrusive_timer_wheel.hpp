@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace exec {
+  template <auto Key, auto Prev, auto Next>
+  class intrusive_timer_wheel;
+
+  // A hierarchical timing wheel with levels of 64 slots. Slot i of level k holds the nodes that
+  // expire in the i-th span of 64^k ticks of the current rotation of that level. Each time the
+  // wheel reaches the beginning of such a span, the nodes of the slot are moved to lower levels.
+  // Thus insertion and erasure take constant time and every node is moved at most once per level.
+  //
+  // Deadlines are rounded up to whole ticks, so nodes never expire early but may expire up to
+  // one tick late. Nodes that expire in the same tick are expired in no particular order.
+  //
+  // The nodes of a slot form a doubly linked list. Prev points to the pointer that points to the
+  // node, which lets erase() unlink a node without knowing its slot. A node with a null Prev is
+  // not in the wheel.
+  template <
+    class Node,
+    class TimePoint,
+    TimePoint Node::*Key,
+    Node** Node::*Prev,
+    Node* Node::*Next>
+  class intrusive_timer_wheel<Key, Prev, Next> {
+   public:
+    using time_point = TimePoint;
+    using duration = typename TimePoint::duration;
+
+    explicit intrusive_timer_wheel(duration resolution, time_point origin) noexcept
+      : resolution_{resolution > duration::zero() ? resolution : duration{1}}
+      , origin_{origin} {
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return size_ == 0;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return size_;
+    }
+
+    void insert(Node* node) noexcept {
+      size_ += 1;
+      place(node);
+    }
+
+    bool erase(Node* node) noexcept {
+      if (node->*Prev == nullptr) {
+        // node is not in the wheel
+        return false;
+      }
+      unlink(node);
+      size_ -= 1;
+      return true;
+    }
+
+    // Removes all nodes whose deadline is not after now and calls fn with each of them.
+    template <class Fn>
+    void expire(time_point now, Fn fn) noexcept {
+      const std::uint64_t target = floor_tick(now);
+      if (size_ == 0) {
+        // Slots that became empty by erasure may still be marked as occupied.
+        occupied_ = {};
+        current_ = std::max(current_, target);
+        return;
+      }
+      expire_list(due_, fn);
+      while (size_ != 0) {
+        const std::optional<std::uint64_t> tick = next_event_tick();
+        if (!tick || *tick > target) {
+          break;
+        }
+        current_ = *tick;
+        for (std::size_t level = n_levels - 1; level > 0; --level) {
+          if ((current_ & span_mask(level)) == 0) {
+            cascade(level, slot_index(current_, level));
+          }
+        }
+        expire_list(due_, fn);
+        const std::size_t index = slot_index(current_, 0);
+        occupied_[0] &= ~(std::uint64_t{1} << index);
+        expire_list(slots_[0][index], fn);
+      }
+      current_ = std::max(current_, target);
+    }
+
+    // Returns the time at which the next node may expire. The wheel may have to move nodes to
+    // lower levels at that time instead of expiring any of them.
+    [[nodiscard]]
+    std::optional<time_point> next_expiry() const noexcept {
+      if (size_ == 0) {
+        return std::nullopt;
+      }
+      if (due_ != nullptr) {
+        return time_of(current_);
+      }
+      const std::optional<std::uint64_t> tick = next_event_tick();
+      if (!tick) {
+        return std::nullopt;
+      }
+      return time_of(*tick);
+    }
+
+    // Removes all nodes and calls fn with each of them.
+    template <class Fn>
+    void clear(Fn fn) noexcept {
+      expire_list(due_, fn);
+      for (std::size_t level = 0; level < n_levels; ++level) {
+        for (Node*& head: slots_[level]) {
+          expire_list(head, fn);
+        }
+        occupied_[level] = 0;
+      }
+    }
+
+   private:
+    static constexpr std::size_t slot_bits = 6;
+    static constexpr std::size_t n_slots = std::size_t{1} << slot_bits;
+    static constexpr std::size_t n_levels = 5;
+
+    static constexpr std::uint64_t span_mask(std::size_t level) noexcept {
+      return (std::uint64_t{1} << (slot_bits * level)) - 1;
+    }
+
+    static constexpr std::size_t slot_index(std::uint64_t tick, std::size_t level) noexcept {
+      return static_cast<std::size_t>(tick >> (slot_bits * level)) & (n_slots - 1);
+    }
+
+    std::uint64_t floor_tick(time_point tp) const noexcept {
+      const duration since_origin = tp - origin_;
+      if (since_origin <= duration::zero()) {
+        return 0;
+      }
+      return static_cast<std::uint64_t>(since_origin / resolution_);
+    }
+
+    std::uint64_t ceil_tick(time_point tp) const noexcept {
+      const duration since_origin = tp - origin_;
+      if (since_origin <= duration::zero()) {
+        return 0;
+      }
+      const auto ticks = static_cast<std::uint64_t>(since_origin / resolution_);
+      return since_origin % resolution_ == duration::zero() ? ticks : ticks + 1;
+    }
+
+    time_point time_of(std::uint64_t tick) const noexcept {
+      return origin_ + resolution_ * static_cast<typename duration::rep>(tick);
+    }
+
+    static void push(Node*& head, Node* node) noexcept {
+      node->*Next = head;
+      if (head) {
+        head->*Prev = &(node->*Next);
+      }
+      node->*Prev = &head;
+      head = node;
+    }
+
+    static void unlink(Node* node) noexcept {
+      *(node->*Prev) = node->*Next;
+      if (node->*Next) {
+        node->*Next->*Prev = node->*Prev;
+      }
+      node->*Prev = nullptr;
+      node->*Next = nullptr;
+    }
+
+    void place(Node* node) noexcept {
+      const std::uint64_t tick = ceil_tick(node->*Key);
+      if (tick <= current_) {
+        push(due_, node);
+        return;
+      }
+      std::uint64_t delta = tick - current_;
+      std::size_t level = 0;
+      while (level < n_levels - 1 && delta >= (std::uint64_t{1} << (slot_bits * (level + 1)))) {
+        level += 1;
+      }
+      // Deadlines beyond the range of the wheel wait in the last slot of the top level and are
+      // placed again from there.
+      const std::uint64_t max_delta = (n_slots - 1) << (slot_bits * (n_levels - 1));
+      delta = std::min(delta, max_delta);
+      const std::size_t index = slot_index(current_ + delta, level);
+      occupied_[level] |= std::uint64_t{1} << index;
+      push(slots_[level][index], node);
+    }
+
+    void cascade(std::size_t level, std::size_t index) noexcept {
+      occupied_[level] &= ~(std::uint64_t{1} << index);
+      Node* node = slots_[level][index];
+      while (node) {
+        Node* next = node->*Next;
+        unlink(node);
+        place(node);
+        node = next;
+      }
+    }
+
+    template <class Fn>
+    void expire_list(Node*& head, Fn& fn) noexcept {
+      Node* node = head;
+      while (node) {
+        Node* next = node->*Next;
+        unlink(node);
+        size_ -= 1;
+        fn(node);
+        node = next;
+      }
+    }
+
+    // Returns the first tick after the current one at which a slot with nodes is reached.
+    // Slots that became empty by erasure are still reported and are skipped once reached.
+    std::optional<std::uint64_t> next_event_tick() const noexcept {
+      std::optional<std::uint64_t> result{};
+      for (std::size_t level = 0; level < n_levels; ++level) {
+        if (occupied_[level] == 0) {
+          continue;
+        }
+        const std::uint64_t span = current_ >> (slot_bits * level);
+        const auto position = static_cast<int>((slot_index(current_, level) + 1) % n_slots);
+        const auto distance = std::countr_zero(std::rotr(occupied_[level], position));
+        const std::uint64_t tick = (span + distance + 1) << (slot_bits * level);
+        if (!result || tick < *result) {
+          result = tick;
+        }
+      }
+      return result;
+    }
+
+    duration resolution_;
+    time_point origin_;
+    std::uint64_t current_{0};
+    std::size_t size_{0};
+    Node* due_{nullptr};
+    std::array<std::uint64_t, n_levels> occupied_{};
+    std::array<std::array<Node*, n_slots>, n_levels> slots_{};
+  };
+} // namespace exec
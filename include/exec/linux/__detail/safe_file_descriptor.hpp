@@ -52,6 +52,10 @@ namespace exec {
     __fd_ = __fd;
   }
 
+  inline auto safe_file_descriptor::release() noexcept -> int {
+    return std::exchange(__fd_, -1);
+  }
+
   inline safe_file_descriptor::operator bool() const noexcept {
     return __fd_ != -1;
   }
@@ -22,11 +22,14 @@
 #  include <linux/io_uring.h>
 
 #  include "../../stdexec/execution.hpp"
+#  include "../../stdexec/__detail/__spin_loop_pause.hpp"
 #  include "../timed_scheduler.hpp"
 
 #  include "../__detail/__atomic_intrusive_queue.hpp"
 #  include "../__detail/__atomic_ref.hpp"
 #  include "../__detail/__bit_cast.hpp"
+#  include "../__detail/intrusive_heap.hpp"
+#  include "../__detail/__system_context_replaceability_api.hpp"
 
 #  include "./safe_file_descriptor.hpp"
 #  include "./memory_mapped_region.hpp"
@@ -47,6 +50,31 @@
 
 #    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
 #      define STDEXEC_HAS_IORING_OP_READ
+#      define STDEXEC_HAS_IORING_OP_OPENAT2
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 7, 0)
+#      define STDEXEC_HAS_IORING_OP_SPLICE
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 8, 0)
+#      define STDEXEC_HAS_IORING_OP_TEE
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+#      define STDEXEC_HAS_IORING_OP_RENAMEAT
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0)
+#      define STDEXEC_HAS_IORING_POLL_ADD_MULTI
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 18, 0)
+#      define STDEXEC_HAS_IORING_OP_MSG_RING
+#    endif
+
+#    if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+#      define STDEXEC_HAS_IORING_OP_SEND_ZC
 #    endif
 
 #    include <sys/uio.h>
@@ -54,7 +82,18 @@
 #    include <sys/syscall.h>
 
 #    include <algorithm>
+#    include <array>
+#    include <bit>
+#    include <chrono>
+#    include <cstddef>
+#    include <cstdint>
 #    include <cstring>
+#    include <limits>
+#    include <memory>
+#    include <optional>
+#    include <span>
+#    include <variant>
+#    include <vector>
 
 namespace exec {
   namespace __io_uring {
@@ -73,6 +112,20 @@ namespace exec {
       return safe_file_descriptor{rc};
     }
 
+    inline auto __io_uring_register(
+      int __ring_fd,
+      unsigned int __opcode,
+      void* __arg,
+      unsigned int __nr_args) -> int {
+      int rc = static_cast<int>(
+        ::syscall(__NR_io_uring_register, __ring_fd, __opcode, __arg, __nr_args));
+      if (rc == -1) {
+        return -errno;
+      } else {
+        return rc;
+      }
+    }
+
     inline auto __io_uring_enter(
       int __ring_fd,
       unsigned int __to_submit,
@@ -95,11 +148,161 @@ namespace exec {
       return memory_mapped_region{__ptr, __size};
     }
 
+    /// Parameters that control how the io_uring instance of an io_uring_context is set up
+    /// and how the context drives it.
+    struct __context_options {
+      /// The number of submission queue entries.
+      unsigned entries = 1024;
+      /// The number of completion queue entries (IORING_SETUP_CQSIZE). Zero selects the kernel
+      /// default of twice the number of submission queue entries.
+      unsigned cq_entries = 0;
+      /// The maximum number of operations in flight in the kernel. Further operations wait in
+      /// the context until earlier ones complete. Zero limits them to the size of the completion
+      /// queue. Larger limits are only honored if the kernel keeps completions that do not fit
+      /// into the completion queue (IORING_FEAT_NODROP); this allows many long-lived
+      /// operations, such as receives on idle sockets, without a huge completion queue.
+      std::size_t max_in_flight = 0;
+      /// Raw IORING_SETUP_* flags that are passed to io_uring_setup in addition to the flags
+      /// implied by the options below.
+      unsigned flags = 0;
+      /// Let a kernel thread poll the submission queue (IORING_SETUP_SQPOLL).
+      /// Submissions do not require a system call as long as the polling thread is awake.
+      bool sq_poll = false;
+      /// The time after which an idle submission queue polling thread goes to sleep.
+      /// Zero selects the kernel default.
+      std::chrono::milliseconds sq_thread_idle{0};
+      /// Pins the submission queue polling thread to the given CPU (IORING_SETUP_SQ_AFF).
+      std::optional<unsigned> sq_thread_cpu{};
+      /// Do not interrupt the driving thread to run completion work (IORING_SETUP_COOP_TASKRUN).
+      bool coop_taskrun = false;
+      /// Only the thread that drives the context submits work to the kernel
+      /// (IORING_SETUP_SINGLE_ISSUER). The first thread that runs the context becomes the
+      /// issuer and the context must not be driven by any other thread afterwards.
+      bool single_issuer = false;
+      /// Defer completion work until the driving thread waits for completions
+      /// (IORING_SETUP_DEFER_TASKRUN). Implies single_issuer.
+      bool defer_taskrun = false;
+      /// The maximum number of completions that are reaped before pending work gets
+      /// resubmitted. Zero reaps all available completions.
+      unsigned completion_batch_size = 0;
+      /// Spin on the completion queue for up to this long before the driving thread blocks in
+      /// io_uring_enter. This trades cpu time for a lower wake-up latency. Zero blocks right
+      /// away. Completions that the kernel defers to the driving thread (defer_taskrun) are only
+      /// seen once it enters the kernel.
+      std::chrono::nanoseconds busy_poll{0};
+      /// Poll the devices for completions instead of waiting for interrupts
+      /// (IORING_SETUP_IOPOLL). Only reads and writes on files that were opened with O_DIRECT
+      /// and whose file system and device support polling can be submitted to such a context;
+      /// timers and other operations fail with EINVAL. The driving thread never blocks.
+      bool io_poll = false;
+      /// Count deferred submissions and overflows of the completion queue. If the library is
+      /// built with STDEXEC_ENABLE_IO_URING_STATISTICS, also count submissions and completions
+      /// per opcode and record how long operations take. See io_uring_context::statistics().
+      bool collect_statistics = false;
+      /// Keep the timers of schedule_after and schedule_at in a heap in user space and arm a
+      /// single kernel timeout for the earliest deadline instead of submitting an
+      /// IORING_OP_TIMEOUT per timer. This keeps large numbers of timers, such as the idle
+      /// timeouts of connections, out of the ring. Requires Linux 5.5.
+      bool coalesce_timers = false;
+      /// Coalesced timers may fire up to this much later than their deadline. Timers that
+      /// expire within the slack of each other fire in the same wake-up, and new timers that
+      /// expire within the slack of the armed kernel timeout do not re-arm it.
+      std::chrono::nanoseconds timer_slack{0};
+    };
+
+    /// @brief A histogram of durations with buckets that double in size.
+    ///
+    /// Bucket 0 counts durations of zero nanoseconds and bucket i > 0 counts durations in
+    /// [2^(i-1), 2^i) nanoseconds. The last bucket also counts all longer durations.
+    struct __latency_histogram {
+      static constexpr std::size_t __n_buckets = 40;
+
+      std::array<std::uint64_t, __n_buckets> buckets{};
+
+      static auto __bucket_of(std::chrono::nanoseconds __duration) noexcept -> std::size_t {
+        const auto __ns = static_cast<std::uint64_t>(std::max<std::int64_t>(__duration.count(), 0));
+        return std::min<std::size_t>(std::bit_width(__ns), __n_buckets - 1);
+      }
+
+      /// @brief Returns the number of recorded durations.
+      [[nodiscard]]
+      auto count() const noexcept -> std::uint64_t {
+        std::uint64_t __count = 0;
+        for (std::uint64_t __n: buckets) {
+          __count += __n;
+        }
+        return __count;
+      }
+
+      /// @brief Returns an upper bound of the given quantile in [0, 1], or zero if the histogram
+      /// is empty.
+      [[nodiscard]]
+      auto quantile(double __q) const noexcept -> std::chrono::nanoseconds {
+        const std::uint64_t __count = count();
+        if (__count == 0) {
+          return std::chrono::nanoseconds{0};
+        }
+        const auto __rank =
+          static_cast<std::uint64_t>(std::clamp(__q, 0.0, 1.0) * double(__count - 1));
+        std::uint64_t __seen = 0;
+        std::size_t __i = 0;
+        for (; __i < __n_buckets - 1; ++__i) {
+          __seen += buckets[__i];
+          if (__seen > __rank) {
+            break;
+          }
+        }
+        return std::chrono::nanoseconds{std::int64_t{1} << __i};
+      }
+    };
+
+    /// @brief The statistics of one io_uring opcode.
+    struct __opcode_statistics {
+      std::uint8_t opcode = 0;
+      /// The number of operations that have been handed to the kernel.
+      std::uint64_t submissions = 0;
+      /// The number of operations that the kernel has completed.
+      std::uint64_t completions = 0;
+      /// The number of operations that failed with an error other than ECANCELED.
+      std::uint64_t errors = 0;
+      /// The number of operations that completed with ECANCELED.
+      std::uint64_t cancellations = 0;
+      /// The number of operations that had to wait in the context before they could be
+      /// submitted, because the submission queue was full or too many operations were in flight.
+      std::uint64_t deferrals = 0;
+      /// The time from the submission of an operation until the driving thread reaped its
+      /// completion from the completion queue.
+      __latency_histogram latency{};
+      /// The time that the driving thread spent in the completion handler of an operation,
+      /// which includes all continuations that ran inline.
+      __latency_histogram handler_time{};
+    };
+
+    /// @brief A snapshot of the statistics of an io_uring_context.
+    struct __statistics {
+      /// The statistics of all opcodes that have been submitted, ordered by opcode. Only
+      /// collected if the library is built with STDEXEC_ENABLE_IO_URING_STATISTICS.
+      std::vector<__opcode_statistics> opcodes{};
+      /// The number of submission passes that ran out of space in the submission or completion
+      /// queue and had to defer operations to a later pass.
+      std::uint64_t deferred_submissions = 0;
+      /// The total time during which deferred operations were waiting in the context, either
+      /// for space in the submission queue or for the number of operations in flight to drop
+      /// below its limit.
+      std::chrono::nanoseconds pending_time{0};
+      /// The number of times that the completion queue overflowed and the completions that the
+      /// kernel kept aside had to be flushed into it.
+      std::uint64_t cq_overflows = 0;
+      /// The number of completions that the kernel dropped because the completion queue was
+      /// full. This is always zero if the kernel supports IORING_FEAT_NODROP.
+      std::uint64_t dropped_completions = 0;
+    };
+
     // This base class maps the kernel's io_uring data structures into the process.
     struct __context_base : stdexec::__immovable {
-      explicit __context_base(unsigned __entries, unsigned __flags = 0)
-        : __params_{__context_base::__init_params(__flags)}
-        , __ring_fd_{__io_uring_setup(__entries, __params_)}
+      explicit __context_base(const __context_options& __options)
+        : __params_{__context_base::__init_params(__options)}
+        , __ring_fd_{__io_uring_setup(std::max(__options.entries, 2u), __params_)}
         , __eventfd_{::eventfd(0, EFD_CLOEXEC)} {
         __throw_error_code_if(!__eventfd_, errno);
         auto __sring_sz = __params_.sq_off.array + __params_.sq_entries * sizeof(unsigned);
@@ -116,9 +319,47 @@ namespace exec {
         }
       }
 
-      static ::io_uring_params __init_params(unsigned __flags) noexcept {
+      static ::io_uring_params __init_params(const __context_options& __options) {
         ::io_uring_params __params{};
-        __params.flags = __flags;
+        __params.flags = __options.flags;
+        if (__options.cq_entries != 0) {
+          __params.flags |= IORING_SETUP_CQSIZE;
+          __params.cq_entries = __options.cq_entries;
+        }
+        if (__options.io_poll) {
+          __params.flags |= IORING_SETUP_IOPOLL;
+        }
+        if (__options.sq_poll) {
+          __params.flags |= IORING_SETUP_SQPOLL;
+          __params.sq_thread_idle = static_cast<__u32>(__options.sq_thread_idle.count());
+          if (__options.sq_thread_cpu) {
+            __params.flags |= IORING_SETUP_SQ_AFF;
+            __params.sq_thread_cpu = *__options.sq_thread_cpu;
+          }
+        }
+        if (__options.coop_taskrun) {
+#    ifdef IORING_SETUP_COOP_TASKRUN
+          __params.flags |= IORING_SETUP_COOP_TASKRUN;
+#    else
+          __throw_error_code_if(true, EINVAL);
+#    endif
+        }
+        if (__options.single_issuer || __options.defer_taskrun) {
+#    if defined(IORING_SETUP_SINGLE_ISSUER) && defined(IORING_SETUP_R_DISABLED)
+          // The kernel binds a single issuer ring to the thread that creates it. We create the
+          // ring disabled and enable it from the first thread that drives the context instead.
+          __params.flags |= IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_R_DISABLED;
+#    else
+          __throw_error_code_if(true, EINVAL);
+#    endif
+        }
+        if (__options.defer_taskrun) {
+#    ifdef IORING_SETUP_DEFER_TASKRUN
+          __params.flags |= IORING_SETUP_DEFER_TASKRUN;
+#    else
+          __throw_error_code_if(true, EINVAL);
+#    endif
+        }
         return __params;
       }
 
@@ -148,7 +389,14 @@ namespace exec {
       void (*__submit_)(__task*, ::io_uring_sqe&) noexcept;
       // This function is called when the io operation is completed.
       // The status of the operation is passed as a parameter.
+      // Operations that post several completions are called once for each of them. All but the
+      // last completion have IORING_CQE_F_MORE set.
       void (*__complete_)(__task*, const ::io_uring_cqe&) noexcept;
+      // Tasks that are linked with IOSQE_IO_LINK return the next task of their chain here.
+      // Only the first task of a chain is put into the queues of the context. The whole chain is
+      // placed into the submission queue at once and the kernel starts each task after its
+      // predecessor has completed successfully.
+      __task* (*__link_next_)(__task*) noexcept = nullptr;
     };
 
     // This is the base class for all io operations.
@@ -156,6 +404,12 @@ namespace exec {
     struct __task : stdexec::__immovable {
       const __task_vtable* __vtable_;
       __task* __next_{nullptr};
+#    if STDEXEC_ENABLE_IO_URING_STATISTICS
+      // The opcode and the submission time of the task. Only recorded if the context collects
+      // statistics.
+      std::uint8_t __opcode_{0xff};
+      std::chrono::steady_clock::time_point __submitted_at_{};
+#    endif
 
       explicit __task(const __task_vtable& __vtable)
         : __vtable_{&__vtable} {
@@ -176,6 +430,171 @@ namespace exec {
       __task_queue __ready;
     };
 
+    // Collects the statistics of a context. Counters are only written by the thread that drives
+    // the context and may be read concurrently by other threads.
+    class __statistics_recorder {
+      // The opcodes that are known today fit into this table. Other opcodes are not recorded.
+      static constexpr std::size_t __n_opcodes = 64;
+
+      struct __counters {
+        std::atomic<std::uint64_t> __submissions_{0};
+        std::atomic<std::uint64_t> __completions_{0};
+        std::atomic<std::uint64_t> __errors_{0};
+        std::atomic<std::uint64_t> __cancellations_{0};
+        std::atomic<std::uint64_t> __deferrals_{0};
+        std::array<std::atomic<std::uint64_t>, __latency_histogram::__n_buckets> __latency_{};
+        std::array<std::atomic<std::uint64_t>, __latency_histogram::__n_buckets> __handler_time_{};
+      };
+
+      static void __increment(std::atomic<std::uint64_t>& __counter) noexcept {
+        __counter.store(
+          __counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      }
+
+      static void __load_into(
+        const std::array<std::atomic<std::uint64_t>, __latency_histogram::__n_buckets>& __from,
+        __latency_histogram& __to) noexcept {
+        for (std::size_t __i = 0; __i < __latency_histogram::__n_buckets; ++__i) {
+          __to.buckets[__i] = __from[__i].load(std::memory_order_relaxed);
+        }
+      }
+
+      static auto __now_ns() noexcept -> std::int64_t {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+      }
+
+      std::array<__counters, __n_opcodes> __counters_{};
+      std::atomic<std::uint64_t> __deferred_submissions_{0};
+      std::atomic<std::uint64_t> __cq_overflows_{0};
+      std::atomic<std::int64_t> __pending_ns_{0};
+      // The time at which operations started to wait in the context, or zero if none wait.
+      std::atomic<std::int64_t> __pending_since_{0};
+      const __task* __ignored_;
+
+     public:
+      // The ignored task is the internal wakeup operation, whose reads would only measure the
+      // idle time of the context.
+      explicit __statistics_recorder(const __task* __ignored) noexcept
+        : __ignored_{__ignored} {
+      }
+
+#    if STDEXEC_ENABLE_IO_URING_STATISTICS
+      // Marks a task that waits in the context. Its opcode is only known once it is submitted.
+      static constexpr std::uint8_t __deferred_opcode = 0xfe;
+
+      void __deferred(__task& __op) noexcept {
+        __op.__opcode_ = __deferred_opcode;
+      }
+
+      void __submitted(__task& __op, __u8 __opcode) noexcept {
+        const bool __was_deferred = __op.__opcode_ == __deferred_opcode;
+        if (&__op == __ignored_ || __opcode >= __n_opcodes) {
+          __op.__opcode_ = 0xff;
+          return;
+        }
+        __op.__opcode_ = __opcode;
+        __op.__submitted_at_ = std::chrono::steady_clock::now();
+        __increment(__counters_[__opcode].__submissions_);
+        if (__was_deferred) {
+          __increment(__counters_[__opcode].__deferrals_);
+        }
+      }
+#    else
+      void __deferred(__task&) noexcept {
+      }
+
+      void __submitted(__task&, __u8) noexcept {
+      }
+#    endif
+
+      // Completes the given task and records its latency and the time spent in its handler.
+      void __complete(
+        __task* __op,
+        const ::io_uring_cqe& __cqe,
+        [[maybe_unused]] std::chrono::steady_clock::time_point __reaped_at) noexcept {
+#    if !STDEXEC_ENABLE_IO_URING_STATISTICS
+        __op->__vtable_->__complete_(__op, __cqe);
+#    else
+        const std::uint8_t __opcode = __op->__opcode_;
+        if (__opcode >= __n_opcodes) {
+          __op->__vtable_->__complete_(__op, __cqe);
+          return;
+        }
+        __counters& __c = __counters_[__opcode];
+#    ifdef IORING_CQE_F_MORE
+        const bool __is_last = !(__cqe.flags & IORING_CQE_F_MORE);
+#    else
+        const bool __is_last = true;
+#    endif
+        if (__is_last) {
+          __increment(__c.__completions_);
+          if (__cqe.res == -ECANCELED) {
+            __increment(__c.__cancellations_);
+          } else if (__cqe.res < 0 && !(__opcode == IORING_OP_TIMEOUT && __cqe.res == -ETIME)) {
+            __increment(__c.__errors_);
+          }
+          __increment(
+            __c.__latency_[__latency_histogram::__bucket_of(__reaped_at - __op->__submitted_at_)]);
+        }
+        // The task may be gone after its completion handler has returned.
+        __op->__vtable_->__complete_(__op, __cqe);
+        __increment(__c.__handler_time_[__latency_histogram::__bucket_of(
+          std::chrono::steady_clock::now() - __reaped_at)]);
+#    endif
+      }
+
+      // Called after each submission pass with whether operations had to be deferred.
+      void __pending(bool __has_pending) noexcept {
+        const std::int64_t __since = __pending_since_.load(std::memory_order_relaxed);
+        if (__has_pending) {
+          __increment(__deferred_submissions_);
+          if (__since == 0) {
+            __pending_since_.store(__now_ns(), std::memory_order_relaxed);
+          }
+        } else if (__since != 0) {
+          __pending_ns_.store(
+            __pending_ns_.load(std::memory_order_relaxed) + (__now_ns() - __since),
+            std::memory_order_relaxed);
+          __pending_since_.store(0, std::memory_order_relaxed);
+        }
+      }
+
+      void __cq_overflowed() noexcept {
+        __increment(__cq_overflows_);
+      }
+
+      [[nodiscard]]
+      auto __snapshot() const -> __statistics {
+        __statistics __result{};
+        for (std::size_t __i = 0; __i < __n_opcodes; ++__i) {
+          const __counters& __c = __counters_[__i];
+          const std::uint64_t __submissions = __c.__submissions_.load(std::memory_order_relaxed);
+          if (__submissions == 0) {
+            continue;
+          }
+          __opcode_statistics& __op = __result.opcodes.emplace_back();
+          __op.opcode = static_cast<std::uint8_t>(__i);
+          __op.submissions = __submissions;
+          __op.completions = __c.__completions_.load(std::memory_order_relaxed);
+          __op.errors = __c.__errors_.load(std::memory_order_relaxed);
+          __op.cancellations = __c.__cancellations_.load(std::memory_order_relaxed);
+          __op.deferrals = __c.__deferrals_.load(std::memory_order_relaxed);
+          __load_into(__c.__latency_, __op.latency);
+          __load_into(__c.__handler_time_, __op.handler_time);
+        }
+        __result.deferred_submissions = __deferred_submissions_.load(std::memory_order_relaxed);
+        __result.cq_overflows = __cq_overflows_.load(std::memory_order_relaxed);
+        std::int64_t __pending_ns = __pending_ns_.load(std::memory_order_relaxed);
+        if (const std::int64_t __since = __pending_since_.load(std::memory_order_relaxed)) {
+          __pending_ns += std::max<std::int64_t>(__now_ns() - __since, 0);
+        }
+        __result.pending_time = std::chrono::nanoseconds{__pending_ns};
+        return __result;
+      }
+    };
+
     inline void __stop(__task* __op) noexcept {
       ::io_uring_cqe __cqe{};
       __cqe.res = -ECANCELED;
@@ -187,21 +606,54 @@ namespace exec {
     class __submission_queue {
       __atomic_ref<__u32> __head_;
       __atomic_ref<__u32> __tail_;
+      __atomic_ref<__u32> __flags_;
       __u32* __array_;
       ::io_uring_sqe* __entries_;
       __u32 __mask_;
       __u32 __n_total_slots_;
+      __statistics_recorder* __statistics_;
+      static auto __chain_length(__task* __op) noexcept -> __u32 {
+        __u32 __length = 0;
+        for (; __op != nullptr; __op = __op->__vtable_->__link_next_(__op)) {
+          ++__length;
+        }
+        return __length;
+      }
+
      public:
       explicit __submission_queue(
         const memory_mapped_region& __region,
         const memory_mapped_region& __sqes_region,
-        const ::io_uring_params& __params)
+        const ::io_uring_params& __params,
+        __statistics_recorder* __statistics = nullptr)
         : __head_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.head)}
         , __tail_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.tail)}
+        , __flags_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.flags)}
         , __array_{__at_offset_as<__u32*>(__region.data(), __params.sq_off.array)}
         , __entries_{static_cast<::io_uring_sqe*>(__sqes_region.data())}
         , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.sq_off.ring_mask)}
-        , __n_total_slots_{__params.sq_entries} {
+        , __n_total_slots_{__params.sq_entries}
+        , __statistics_{__statistics} {
+      }
+
+      // Returns true if the kernel's submission queue polling thread went to sleep and needs to
+      // be woken up by io_uring_enter with IORING_ENTER_SQ_WAKEUP.
+      [[nodiscard]]
+      auto needs_wakeup() const noexcept -> bool {
+        // The store of the tail must not be reordered with the load of the flags.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return __flags_.load(std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP;
+      }
+
+      // Returns true if completions did not fit into the completion queue. The kernel keeps
+      // them aside until the next io_uring_enter with IORING_ENTER_GETEVENTS.
+      [[nodiscard]]
+      auto cq_overflowed() const noexcept -> bool {
+#    ifdef IORING_SQ_CQ_OVERFLOW
+        return __flags_.load(std::memory_order_acquire) & IORING_SQ_CQ_OVERFLOW;
+#    else
+        return false;
+#    endif
       }
 
       // This function submits the given queue of tasks to the io_uring.
@@ -212,6 +664,7 @@ namespace exec {
       // If is_stopped is true, no new tasks are submitted to the io_uring unless it is a cancellation.
       // If is_stopped is true and a task is not ready to be completed, the task is completed with
       // an io_uring_cqe object with the result field set to -ECANCELED.
+      // A chain of linked tasks is either submitted as a whole or moved to the __pending queue.
       auto submit(__task_queue __tasks, __u32 __max_submissions, bool __is_stopped) noexcept
         -> __submission_result {
         __u32 __tail = __tail_.load(std::memory_order_relaxed);
@@ -228,6 +681,34 @@ namespace exec {
           STDEXEC_ASSERT(__op->__vtable_);
           if (__op->__vtable_->__ready_(__op)) {
             __result.__ready.push_back(__op);
+          } else if (__op->__vtable_->__link_next_) {
+            const __u32 __length = __chain_length(__op);
+            STDEXEC_ASSERT(__length <= __n_total_slots_);
+            if (__max_submissions - __result.__n_submitted < __length) {
+              __tasks.push_front(__op);
+              break;
+            }
+            for (__task* __link = __op; __link != nullptr;) {
+              __task* __next = __link->__vtable_->__link_next_(__link);
+              const __u32 __link_index = __tail & __mask_;
+              ::io_uring_sqe& __link_sqe = __entries_[__link_index];
+              __link->__vtable_->__submit_(__link, __link_sqe);
+              if (__is_stopped) {
+                __stop(__link);
+              } else {
+                if (__next) {
+                  __link_sqe.flags |= IOSQE_IO_LINK;
+                }
+                __link_sqe.user_data = bit_cast<__u64>(__link);
+                if (__statistics_) {
+                  __statistics_->__submitted(*__link, __link_sqe.opcode);
+                }
+                __array_[__link_index] = __link_index;
+                ++__result.__n_submitted;
+                ++__tail;
+              }
+              __link = __next;
+            }
           } else {
             __op->__vtable_->__submit_(__op, __sqe);
 #    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
@@ -238,6 +719,9 @@ namespace exec {
               __stop(__op);
             } else {
               __sqe.user_data = bit_cast<__u64>(__op);
+              if (__statistics_) {
+                __statistics_->__submitted(*__op, __sqe.opcode);
+              }
               __array_[__index] = __index;
               ++__result.__n_submitted;
               ++__tail;
@@ -250,6 +734,9 @@ namespace exec {
           if (__op->__vtable_->__ready_(__op)) {
             __result.__ready.push_back(__op);
           } else {
+            if (__statistics_) {
+              __statistics_->__deferred(*__op);
+            }
             __result.__pending.push_back(__op);
           }
         }
@@ -257,36 +744,80 @@ namespace exec {
       }
     };
 
+    // The user data of completions that other rings post to wake up the thread that drives this
+    // ring. These completions do not belong to any task of this ring.
+    inline constexpr __u64 __msg_ring_wakeup_data = 1;
+
     class __completion_queue {
       __atomic_ref<__u32> __head_;
       __atomic_ref<__u32> __tail_;
+      __atomic_ref<__u32> __overflow_;
       ::io_uring_cqe* __entries_;
       __u32 __mask_;
+      __statistics_recorder* __statistics_;
      public:
       explicit __completion_queue(
         const memory_mapped_region& __region,
-        const ::io_uring_params& __params) noexcept
+        const ::io_uring_params& __params,
+        __statistics_recorder* __statistics = nullptr) noexcept
         : __head_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.head)}
         , __tail_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.tail)}
+        , __overflow_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.overflow)}
         , __entries_{__at_offset_as<::io_uring_cqe*>(__region.data(), __params.cq_off.cqes)}
-        , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.ring_mask)} {
+        , __mask_{*__at_offset_as<__u32*>(__region.data(), __params.cq_off.ring_mask)}
+        , __statistics_{__statistics} {
       }
 
-      // This function first completes all tasks that are ready in the completion queue of the io_uring.
-      // Then it completes all tasks that are ready in the given queue of ready tasks.
+      [[nodiscard]]
+      auto empty() const noexcept -> bool {
+        return __head_.load(std::memory_order_relaxed) == __tail_.load(std::memory_order_acquire);
+      }
+
+      // Returns the number of completions that the kernel has dropped because the queue was full.
+      [[nodiscard]]
+      auto dropped() const noexcept -> __u32 {
+        return __overflow_.load(std::memory_order_relaxed);
+      }
+
+      // This function first completes up to __max_count tasks that are ready in the completion
+      // queue of the io_uring. Then it completes all tasks that are ready in the given queue of
+      // ready tasks.
       // The function returns the number of previously submitted completed tasks.
-      auto complete(stdexec::__intrusive_queue<&__task::__next_> __ready = __task_queue{}) noexcept
-        -> int {
+      auto complete(
+        stdexec::__intrusive_queue<&__task::__next_> __ready = __task_queue{},
+        __u32 __max_count = std::numeric_limits<__u32>::max()) noexcept -> int {
         __u32 __head = __head_.load(std::memory_order_relaxed);
         __u32 __tail = __tail_.load(std::memory_order_acquire);
         int __count = 0;
-        while (__head != __tail) {
+        __u32 __n_reaped = 0;
+        std::chrono::steady_clock::time_point __reaped_at{};
+#    if STDEXEC_ENABLE_IO_URING_STATISTICS
+        if (__statistics_ && __head != __tail) {
+          __reaped_at = std::chrono::steady_clock::now();
+        }
+#    endif
+        while (__head != __tail && __n_reaped < __max_count) {
           const __u32 __index = __head & __mask_;
           const ::io_uring_cqe& __cqe = __entries_[__index];
-          auto* __op = bit_cast<__task*>(__cqe.user_data);
-          __op->__vtable_->__complete_(__op, __cqe);
+          if (__cqe.user_data != __msg_ring_wakeup_data) {
+            auto* __op = bit_cast<__task*>(__cqe.user_data);
+            if (__statistics_) {
+              __statistics_->__complete(__op, __cqe, __reaped_at);
+            } else {
+              __op->__vtable_->__complete_(__op, __cqe);
+            }
+#    ifdef IORING_CQE_F_MORE
+            // The submission stays in flight until its last completion arrives. Zero-copy sends,
+            // for example, post a notification once the kernel has released the buffer.
+            if (!(__cqe.flags & IORING_CQE_F_MORE)) {
+              ++__count;
+            }
+#    else
+            ++__count;
+#    endif
+          }
           ++__head;
-          ++__count;
+          ++__n_reaped;
           __tail = __tail_.load(std::memory_order_acquire);
         }
         __head_.store(__head, std::memory_order_release);
@@ -346,8 +877,189 @@ namespace exec {
       void start() & noexcept;
     };
 
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+    // Wakes up the thread that drives another context by posting a completion to its ring with
+    // IORING_OP_MSG_RING. Unlike a write to the eventfd of the other context this does not
+    // require a system call of its own; the message is sent with the next submission batch.
+    struct __msg_ring_operation : __task {
+      __context* __source_ = nullptr;
+      __context* __target_ = nullptr;
+      bool __in_flight_ = false;
+      bool __rearm_ = false;
+
+      static auto __ready_(__task*) noexcept -> bool {
+        return false;
+      }
+
+      static void __submit_(__task* __pointer, ::io_uring_sqe& __entry) noexcept;
+
+      static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept;
+
+      static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+      __msg_ring_operation() noexcept
+        : __task{__vtable} {
+      }
+
+      void start() noexcept;
+    };
+#    endif
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+    // A timer that waits in the timer queue of a context that coalesces timers.
+    struct __timer : __task {
+      std::chrono::steady_clock::time_point __deadline_{};
+      __timer* __prev_{nullptr};
+      __timer* __left_{nullptr};
+      __timer* __right_{nullptr};
+      // Called by the thread that drives the context once the deadline has passed.
+      void (*__expire_)(__timer*) noexcept;
+
+      __timer(const __task_vtable& __vtable, void (*__expire)(__timer*) noexcept) noexcept
+        : __task{__vtable}
+        , __expire_{__expire} {
+      }
+    };
+
+    // Keeps the timers of a context in a heap and arms a single absolute IORING_OP_TIMEOUT for
+    // the earliest deadline plus the slack. A new timer only re-arms the kernel timeout if it
+    // would otherwise fire later than its slack allows, in which case the armed timeout is
+    // cancelled and armed again once the cancellation has completed.
+    //
+    // This class must only be used by the thread that drives the context.
+    class __timer_queue {
+     public:
+      __timer_queue(__context* __context, std::chrono::nanoseconds __slack) noexcept
+        : __context_{__context}
+        , __slack_{std::max(__slack, std::chrono::nanoseconds{0})} {
+      }
+
+      void insert(__timer* __timer) noexcept {
+        __heap_.insert(__timer);
+        __update();
+      }
+
+      // Returns false if the timer has already expired.
+      auto erase(__timer* __timer) noexcept -> bool {
+        if (!__heap_.erase(__timer)) {
+          return false;
+        }
+        __update();
+        return true;
+      }
+
+     private:
+      struct __kernel_timespec {
+        __s64 __tv_sec;
+        __s64 __tv_nsec;
+      };
+
+      struct __timeout_operation : __task {
+        __timer_queue* __queue_;
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto& __self = *static_cast<__timeout_operation*>(__pointer);
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_TIMEOUT;
+          __sqe_.addr = bit_cast<__u64>(&__self.__queue_->__timespec_);
+          __sqe_.len = 1;
+          __sqe_.timeout_flags = IORING_TIMEOUT_ABS;
+          __sqe = __sqe_;
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+          auto& __queue = *static_cast<__timeout_operation*>(__pointer)->__queue_;
+          __queue.__armed_ = false;
+          __queue.__expire();
+          __queue.__update();
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        explicit __timeout_operation(__timer_queue* __queue) noexcept
+          : __task{__vtable}
+          , __queue_{__queue} {
+        }
+      };
+
+      struct __cancel_operation : __task {
+        __timer_queue* __queue_;
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto& __self = *static_cast<__cancel_operation*>(__pointer);
+          ::io_uring_sqe __sqe_{};
+          __sqe_.opcode = IORING_OP_ASYNC_CANCEL;
+          __sqe_.addr = bit_cast<__u64>(static_cast<__task*>(&__self.__queue_->__timeout_op_));
+          __sqe = __sqe_;
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+          auto& __queue = *static_cast<__cancel_operation*>(__pointer)->__queue_;
+          __queue.__cancelling_ = false;
+          __queue.__update();
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        explicit __cancel_operation(__timer_queue* __queue) noexcept
+          : __task{__vtable}
+          , __queue_{__queue} {
+        }
+      };
+
+      // Completes all timers whose deadline has passed.
+      void __expire() noexcept {
+        const auto __now = std::chrono::steady_clock::now();
+        for (__timer* __first = __heap_.front(); __first && __first->__deadline_ <= __now;
+             __first = __heap_.front()) {
+          __heap_.pop_front();
+          __first->__expire_(__first);
+        }
+      }
+
+      // Makes sure that the armed kernel timeout fires early enough for the earliest timer.
+      // A timeout that is no longer needed is cancelled so that it does not keep the context
+      // busy. While a cancellation is in flight, its completion calls this function again.
+      void __update() noexcept;
+
+      void __submit(__task* __task) noexcept;
+
+      using __heap_t = intrusive_heap<
+        &__timer::__deadline_,
+        &__timer::__prev_,
+        &__timer::__left_,
+        &__timer::__right_>;
+
+      __context* __context_;
+      std::chrono::nanoseconds __slack_;
+      __heap_t __heap_{};
+      __timeout_operation __timeout_op_{this};
+      __cancel_operation __cancel_op_{this};
+      __kernel_timespec __timespec_{};
+      std::chrono::steady_clock::time_point __armed_until_{};
+      bool __armed_{false};
+      bool __cancelling_{false};
+    };
+#    endif
+
     class __scheduler;
 
+    // Executors that can collect the tasks that are enqueued to them by one thread and hand
+    // them over at once, such as exec::static_thread_pool.
+    template <class _Executor>
+    concept __enqueue_batching = requires(_Executor& __executor) {
+      { __executor.begin_enqueue_batch() } noexcept;
+      { __executor.end_enqueue_batch() } noexcept;
+    };
+
     enum class until {
       stopped,
       empty
@@ -356,10 +1068,35 @@ namespace exec {
     class __context : __context_base {
      public:
       explicit __context(unsigned __entries = 1024, unsigned __flags = 0)
-        : __context_base(std::max(__entries, 2u), __flags)
-        , __completion_queue_{__completion_queue_region_ ? __completion_queue_region_ : __submission_queue_region_, __params_}
-        , __submission_queue_{__submission_queue_region_, __submission_queue_entries_, __params_}
+        : __context(__context_options{.entries = __entries, .flags = __flags}) {
+      }
+
+      explicit __context(const __context_options& __options)
+        : __context_base(__options)
+        , __completion_batch_size_{
+            __options.completion_batch_size ? __options.completion_batch_size
+                                            : std::numeric_limits<__u32>::max()}
+        , __busy_poll_{__options.busy_poll}
+        , __max_in_flight_{__max_in_flight_for(__options, __params_)}
+        , __statistics_{
+            __options.collect_statistics
+              ? std::make_unique<__statistics_recorder>(&__wakeup_operation_)
+              : nullptr}
+        , __completion_queue_{
+            __completion_queue_region_ ? __completion_queue_region_ : __submission_queue_region_,
+            __params_,
+            __statistics_.get()}
+        , __submission_queue_{
+            __submission_queue_region_,
+            __submission_queue_entries_,
+            __params_,
+            __statistics_.get()}
         , __wakeup_operation_{this, __eventfd_} {
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        if (__options.coalesce_timers) {
+          __timers_.emplace(this, __options.timer_slack);
+        }
+#    endif
       }
 
       void wakeup() {
@@ -367,6 +1104,75 @@ namespace exec {
         __throw_error_code_if(::write(__eventfd_, &__wakeup, sizeof(__wakeup)) == -1, errno);
       }
 
+      /// @brief Returns true if the calling thread is the one that drives this context.
+      auto __is_driven_by_this_thread() const noexcept -> bool {
+        return __current_context() == this;
+      }
+
+      /// @brief Makes sure that the thread driving this context picks up a newly submitted task.
+      ///
+      /// The thread that drives this context picks up new submissions before it blocks again and
+      /// threads that drive a peer context send a message to this ring. Only other threads need
+      /// to write to the eventfd of this context.
+      void __wakeup_after_submit() {
+        __context* __current = __current_context();
+        if (__current == this) {
+          return;
+        }
+        if (__current == nullptr || !__current->__try_wakeup_peer(*this)) {
+          wakeup();
+        }
+      }
+
+      /// @brief Lets this context and the given peer contexts wake each other up by messaging
+      /// their rings directly.
+      ///
+      /// All peers have to contain this context and have to call this function with the same
+      /// span, which must outlive all of them.
+      void __set_peers(std::span<__context* const> __peers) {
+        __peers_ = __peers;
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+        __msg_ring_ops_ = std::make_unique<__msg_ring_operation[]>(__peers.size());
+        for (std::size_t __i = 0; __i < __peers.size(); ++__i) {
+          __msg_ring_ops_[__i].__source_ = this;
+          __msg_ring_ops_[__i].__target_ = __peers[__i];
+          if (__peers[__i] == this) {
+            __peer_index_ = __i;
+          }
+        }
+#    endif
+      }
+
+      /// @brief Returns a snapshot of the statistics of this context.
+      ///
+      /// The snapshot is empty unless the context has been created with collect_statistics.
+      /// It can be taken from any thread while the context is running.
+      [[nodiscard]]
+      auto statistics() const -> __statistics {
+        if (!__statistics_) {
+          return __statistics{};
+        }
+        __statistics __result = __statistics_->__snapshot();
+        __result.dropped_completions = __completion_queue_.dropped();
+        return __result;
+      }
+
+      /// @brief Returns the number of operations that are currently in flight in the kernel.
+      ///
+      /// The value is published by the driving thread and may be slightly out of date.
+      [[nodiscard]]
+      auto __load() const noexcept -> std::ptrdiff_t {
+        return __load_.load(std::memory_order_relaxed);
+      }
+
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+      /// @brief Returns the timer queue of this context, or nullptr if the context does not
+      /// coalesce timers. The queue must only be used by the thread that drives the context.
+      auto __timers() noexcept -> __timer_queue* {
+        return __timers_ ? &*__timers_ : nullptr;
+      }
+#    endif
+
       /// @brief Resets the io context to its initial state.
       void reset() {
         if (__is_running_.load(std::memory_order_relaxed) || __n_total_submitted_ > 0) {
@@ -430,11 +1236,13 @@ namespace exec {
       ///
       /// This function is not thread-safe and must only be called from the thread that drives the io context.
       void run_some() noexcept {
-        __n_total_submitted_ -= __completion_queue_.complete();
+        __n_total_submitted_ -=
+          __complete(__task_queue{}, __completion_batch_size_);
         STDEXEC_ASSERT(
           0 <= __n_total_submitted_
-          && __n_total_submitted_ <= static_cast<std::ptrdiff_t>(__params_.cq_entries));
-        __u32 __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
+          && __n_total_submitted_ <= static_cast<std::ptrdiff_t>(__max_in_flight_));
+        __flush_overflow();
+        __u32 __max_submissions = __max_in_flight_ - static_cast<__u32>(__n_total_submitted_);
         __pending_.append(__requests_.pop_all_reversed());
         __submission_result __result = __submission_queue_.submit(
           static_cast<__task_queue&&>(__pending_),
@@ -442,22 +1250,24 @@ namespace exec {
           __stop_source_->stop_requested());
         __n_total_submitted_ += __result.__n_submitted;
         __n_newly_submitted_ += __result.__n_submitted;
-        STDEXEC_ASSERT(__n_total_submitted_ <= static_cast<std::ptrdiff_t>(__params_.cq_entries));
+        STDEXEC_ASSERT(__n_total_submitted_ <= static_cast<std::ptrdiff_t>(__max_in_flight_));
         __pending_ = static_cast<__task_queue&&>(__result.__pending);
+        __record_pending();
         while (!__result.__ready.empty()) {
-          __n_total_submitted_ -=
-            __completion_queue_.complete(static_cast<__task_queue&&>(__result.__ready));
+          __n_total_submitted_ -= __complete(
+            static_cast<__task_queue&&>(__result.__ready), __completion_batch_size_);
           STDEXEC_ASSERT(0 <= __n_total_submitted_);
           __pending_.append(__requests_.pop_all_reversed());
-          __max_submissions = __params_.cq_entries - static_cast<__u32>(__n_total_submitted_);
+          __max_submissions = __max_in_flight_ - static_cast<__u32>(__n_total_submitted_);
           __result = __submission_queue_.submit(
             static_cast<__task_queue&&>(__pending_),
             __max_submissions,
             __stop_source_->stop_requested());
           __n_total_submitted_ += __result.__n_submitted;
           __n_newly_submitted_ += __result.__n_submitted;
-          STDEXEC_ASSERT(__n_total_submitted_ <= static_cast<std::ptrdiff_t>(__params_.cq_entries));
+          STDEXEC_ASSERT(__n_total_submitted_ <= static_cast<std::ptrdiff_t>(__max_in_flight_));
           __pending_ = static_cast<__task_queue&&>(__result.__pending);
+          __record_pending();
         }
       }
 
@@ -477,36 +1287,35 @@ namespace exec {
             __n_submissions_in_flight_.store(0, std::memory_order_release);
           } else {
             // This can only happen for the very first pass of run_until_stopped()
-            __wakeup_operation_.start();
+            __enable_ring();
+            // Rings that poll for completions cannot read from the eventfd. Their driving thread
+            // never blocks and picks up new work on its own.
+            if (!__is_io_polled()) {
+              __wakeup_operation_.start();
+            }
           }
         }
+        __context* __previous = std::exchange(__current_context(), this);
         scope_guard __not_running{[&]() noexcept {
+          __current_context() = __previous;
+          __load_.store(0, std::memory_order_relaxed);
           __is_running_.store(false, std::memory_order_relaxed);
         }};
         __pending_.append(__requests_.pop_all_reversed());
-        while (__n_total_submitted_ > 0 || !__pending_.empty()) {
+        while (__n_total_submitted_ > 0 || !__pending_.empty() || __keeps_polling()) {
           run_some();
-          if (
-            __n_total_submitted_ == 0
-            || (__n_total_submitted_ == 1 && __break_loop_.load(std::memory_order_acquire))) {
+          __refill_submissions();
+          if (__is_done()) {
             __break_loop_.store(false, std::memory_order_relaxed);
             break;
           }
-          constexpr int __min_complete = 1;
           STDEXEC_ASSERT(
             0 <= __n_total_submitted_
-            && __n_total_submitted_ <= static_cast<std::ptrdiff_t>(__params_.cq_entries));
-          int rc = __io_uring_enter(
-            __ring_fd_,
-            static_cast<unsigned>(__n_newly_submitted_),
-            __min_complete,
-            IORING_ENTER_GETEVENTS);
-          __throw_error_code_if(rc < 0 && rc != -EINTR, -rc);
-          if (rc != -EINTR) {
-            STDEXEC_ASSERT(rc <= __n_newly_submitted_);
-            __n_newly_submitted_ -= rc;
-          }
-          __n_total_submitted_ -= __completion_queue_.complete();
+            && __n_total_submitted_ <= static_cast<std::ptrdiff_t>(__max_in_flight_));
+          __load_.store(__n_total_submitted_, std::memory_order_relaxed);
+          __wait();
+          __n_total_submitted_ -=
+            __complete(__task_queue{}, __completion_batch_size_);
           STDEXEC_ASSERT(0 <= __n_total_submitted_);
           __pending_.append(__requests_.pop_all_reversed());
         }
@@ -531,7 +1340,7 @@ namespace exec {
             static_cast<__task_queue&&>(__pending_), __params_.cq_entries, true);
           STDEXEC_ASSERT(__result.__n_submitted == 0);
           STDEXEC_ASSERT(__result.__pending.empty());
-          __completion_queue_.complete(static_cast<__task_queue&&>(__result.__ready));
+          __complete(static_cast<__task_queue&&>(__result.__ready));
         }
       }
 
@@ -613,8 +1422,273 @@ namespace exec {
 
       auto get_scheduler() noexcept -> __scheduler;
 
+      /// @brief Batches the continuations that the completions of one pass over the completion
+      /// queue enqueue to the given executor.
+      ///
+      /// Continuations that are transferred to the executor, e.g. by continue_on, are handed to
+      /// it at once after all completions that were reaped together have run, or earlier if the
+      /// executor bounds its batches. This must not be called while the context is running. The
+      /// executor must outlive the context.
+      ///
+      /// Completions that run inline on the thread of the context must not block on work that
+      /// they transfer to the executor, e.g. with sync_wait(schedule(pool)), because that work
+      /// is only handed over once the pass is done.
+      template <__enqueue_batching _Executor>
+      void set_continuation_batch(_Executor& __executor) noexcept {
+        __batch_ = &__executor;
+        __begin_batch_ = [](void* __pointer) noexcept {
+          static_cast<_Executor*>(__pointer)->begin_enqueue_batch();
+        };
+        __end_batch_ = [](void* __pointer) noexcept {
+          static_cast<_Executor*>(__pointer)->end_enqueue_batch();
+        };
+      }
+
+      /// @brief Stops batching the continuations of completions.
+      void set_continuation_batch(std::nullptr_t) noexcept {
+        __batch_ = nullptr;
+      }
+
      private:
+      // Records whether the last submission pass had to leave tasks pending.
+      void __record_pending() noexcept {
+        if (__statistics_) {
+          __statistics_->__pending(!__pending_.empty());
+        }
+      }
+
+      // Without IORING_FEAT_NODROP the kernel drops completions that do not fit into the
+      // completion queue, so the operations in flight must never exceed its size.
+      static auto
+        __max_in_flight_for(const __context_options& __options, const ::io_uring_params& __params)
+          -> __u32 {
+#    ifdef IORING_FEAT_NODROP
+        if ((__params.features & IORING_FEAT_NODROP) && __options.max_in_flight > 0) {
+          return static_cast<__u32>(std::min<std::size_t>(
+            __options.max_in_flight, std::numeric_limits<__u32>::max() / 2));
+        }
+#    endif
+        if (__options.max_in_flight > 0) {
+          return static_cast<__u32>(
+            std::min<std::size_t>(__options.max_in_flight, __params.cq_entries));
+        }
+        return __params.cq_entries;
+      }
+
+      // Moves the completions that the kernel kept aside after an overflow of the completion
+      // queue into the queue and completes them.
+      void __flush_overflow() noexcept {
+        while (__submission_queue_.cq_overflowed()) {
+          if (__statistics_) {
+            __statistics_->__cq_overflowed();
+          }
+          int rc = __io_uring_enter(__ring_fd_, 0, 0, IORING_ENTER_GETEVENTS);
+          if (rc < 0 && rc != -EINTR && rc != -EBUSY) {
+            return;
+          }
+          __n_total_submitted_ -= __complete(__task_queue{}, __completion_batch_size_);
+          STDEXEC_ASSERT(0 <= __n_total_submitted_);
+        }
+      }
+
+      // Completes the ready tasks and the tasks that the completion queue reaps in one pass.
+      auto __complete(
+        __task_queue __ready,
+        __u32 __max_count = std::numeric_limits<__u32>::max()) noexcept -> int {
+        if (__batch_ == nullptr || (__ready.empty() && __completion_queue_.empty())) {
+          return __completion_queue_.complete(static_cast<__task_queue&&>(__ready), __max_count);
+        }
+        __begin_batch_(__batch_);
+        int __count =
+          __completion_queue_.complete(static_cast<__task_queue&&>(__ready), __max_count);
+        __end_batch_(__batch_);
+        return __count;
+      }
+
       friend struct __wakeup_operation;
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+      friend class __timer_queue;
+#    endif
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+      friend struct __msg_ring_operation;
+#    endif
+
+      // Returns the context that is driven by the calling thread, if any.
+      static auto __current_context() noexcept -> __context*& {
+        static thread_local __context* __current = nullptr;
+        return __current;
+      }
+
+      // Wakes up the given peer by messaging its ring. This must be called from the thread that
+      // drives this context. Returns false if the given context is not a peer of this context.
+      auto __try_wakeup_peer([[maybe_unused]] __context& __target) -> bool {
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+        if (
+          __peers_.empty() || __target.__peers_.data() != __peers_.data()
+          || __msg_ring_unsupported_) {
+          return false;
+        }
+        __msg_ring_ops_[__target.__peer_index_].start();
+        return true;
+#    else
+        return false;
+#    endif
+      }
+
+      [[nodiscard]]
+      auto __is_sq_polled() const noexcept -> bool {
+        return __params_.flags & IORING_SETUP_SQPOLL;
+      }
+
+      [[nodiscard]]
+      auto __is_io_polled() const noexcept -> bool {
+        return __params_.flags & IORING_SETUP_IOPOLL;
+      }
+
+      // A ring that polls for completions has no wakeup operation in flight that keeps the run
+      // loop alive. It keeps polling until the context is stopped.
+      [[nodiscard]]
+      auto __keeps_polling() const noexcept -> bool {
+        return __is_io_polled() && !__stop_source_->stop_requested();
+      }
+
+      // Returns true if the run loop is done. Otherwise the only remaining submission is the
+      // wakeup operation, which stays in flight until the context is stopped.
+      [[nodiscard]]
+      auto __is_done() const noexcept -> bool {
+        if (__is_io_polled()) {
+          return __n_total_submitted_ == 0 && __pending_.empty()
+              && (!__keeps_polling() || __break_loop_.load(std::memory_order_acquire));
+        }
+        return __n_total_submitted_ == 0
+            || (__n_total_submitted_ == 1 && __break_loop_.load(std::memory_order_acquire));
+      }
+
+      // An interrupted io_uring_enter is retried by the run loop. So is one that fails with
+      // EBUSY because the kernel still keeps completions aside after an overflow of the
+      // completion queue; the run loop reaps the completion queue and flushes them first.
+      static auto __is_enter_error(int __rc) noexcept -> bool {
+        return __rc < 0 && __rc != -EINTR && __rc != -EBUSY;
+      }
+
+      // More operations may be in flight than the submission queue holds entries. Hand the
+      // full submission queue to the kernel and fill it again until the pending tasks or the
+      // budget for operations in flight run out.
+      void __refill_submissions() {
+        while (!__pending_.empty() && !__is_sq_polled()
+               && __n_total_submitted_ < static_cast<std::ptrdiff_t>(__max_in_flight_)) {
+          const std::ptrdiff_t __n_unconsumed = __n_newly_submitted_;
+          __flush_submissions();
+          if (__n_newly_submitted_ == __n_unconsumed) {
+            break;
+          }
+          run_some();
+        }
+      }
+
+      // Waits for the next completion or for new work from other threads.
+      void __wait() {
+        if (__is_io_polled()) {
+          __poll();
+        } else if (__busy_poll_.count() == 0 || !__spin()) {
+          __enter();
+        }
+      }
+
+      // Hands newly submitted entries to the kernel without waiting for completions.
+      void __flush_submissions() {
+        if (__is_sq_polled()) {
+          __n_newly_submitted_ = 0;
+          if (__submission_queue_.needs_wakeup()) {
+            int rc = __io_uring_enter(__ring_fd_, 0, 0, IORING_ENTER_SQ_WAKEUP);
+            __throw_error_code_if(__is_enter_error(rc), -rc);
+          }
+        } else if (__n_newly_submitted_ > 0) {
+          int rc = __io_uring_enter(
+            __ring_fd_, static_cast<unsigned>(__n_newly_submitted_), 0, 0);
+          __throw_error_code_if(__is_enter_error(rc), -rc);
+          if (rc > 0) {
+            __n_newly_submitted_ -= rc;
+          }
+        }
+      }
+
+      // Spins on the completion queue until a completion arrives, another thread submits new
+      // work or the busy-poll budget is used up. Returns false in the latter case.
+      auto __spin() -> bool {
+        __flush_submissions();
+        const auto __deadline = std::chrono::steady_clock::now() + __busy_poll_;
+        for (unsigned __n = 1;; ++__n) {
+          if (
+            !__completion_queue_.empty() || !__requests_.empty()
+            || __submission_queue_.cq_overflowed()) {
+            return true;
+          }
+          // Reading the clock is more expensive than a pause, so we only do it every so often.
+          if (__n % 64 == 0 && std::chrono::steady_clock::now() >= __deadline) {
+            return false;
+          }
+          stdexec::__spin_loop_pause();
+        }
+      }
+
+      // Polls the devices for completions once (IORING_SETUP_IOPOLL).
+      void __poll() {
+        if (__is_sq_polled()) {
+          // The submission queue polling thread also polls for completions.
+          __flush_submissions();
+        } else if (__n_total_submitted_ > 0) {
+          int rc = __io_uring_enter(
+            __ring_fd_,
+            static_cast<unsigned>(__n_newly_submitted_),
+            0,
+            IORING_ENTER_GETEVENTS);
+          __throw_error_code_if(__is_enter_error(rc), -rc);
+          if (rc > 0) {
+            __n_newly_submitted_ -= rc;
+          }
+        }
+        if (__completion_queue_.empty()) {
+          stdexec::__spin_loop_pause();
+        }
+      }
+
+      // A ring that has been set up with IORING_SETUP_R_DISABLED is enabled by the first thread
+      // that drives it. For single issuer rings this thread becomes the submitter task.
+      void __enable_ring() {
+#    ifdef IORING_SETUP_R_DISABLED
+        if (__params_.flags & IORING_SETUP_R_DISABLED) {
+          int rc = __io_uring_register(__ring_fd_, IORING_REGISTER_ENABLE_RINGS, nullptr, 0);
+          __throw_error_code_if(rc < 0, -rc);
+          __params_.flags &= ~IORING_SETUP_R_DISABLED;
+        }
+#    endif
+      }
+
+      // Hands newly submitted entries to the kernel and waits for at least one completion.
+      //
+      // If the submission queue is polled by a kernel thread, the submissions do not need a
+      // system call unless the polling thread went to sleep. In this case we also avoid the
+      // system call if there are already completions to be reaped.
+      void __enter() {
+        constexpr int __min_complete = 1;
+        unsigned __flags = IORING_ENTER_GETEVENTS;
+        if (__is_sq_polled()) {
+          __n_newly_submitted_ = 0;
+          if (__submission_queue_.needs_wakeup()) {
+            __flags |= IORING_ENTER_SQ_WAKEUP;
+          } else if (!__completion_queue_.empty()) {
+            return;
+          }
+        }
+        int rc = __io_uring_enter(
+          __ring_fd_, static_cast<unsigned>(__n_newly_submitted_), __min_complete, __flags);
+        __throw_error_code_if(__is_enter_error(rc), -rc);
+        if (rc >= 0 && !__is_sq_polled()) {
+          STDEXEC_ASSERT(rc <= __n_newly_submitted_);
+          __n_newly_submitted_ -= rc;
+        }
+      }
 
       // This constant is used for __n_submissions_in_flight to indicate that no new submissions
       // to this context will be completed by this context.
@@ -625,12 +1699,29 @@ namespace exec {
       std::atomic<bool> __break_loop_{false};
       std::ptrdiff_t __n_total_submitted_{0};
       std::ptrdiff_t __n_newly_submitted_{0};
+      __u32 __completion_batch_size_;
+      std::chrono::nanoseconds __busy_poll_;
+      __u32 __max_in_flight_;
+      std::unique_ptr<__statistics_recorder> __statistics_;
       std::optional<stdexec::inplace_stop_source> __stop_source_{std::in_place};
       __completion_queue __completion_queue_;
       __submission_queue __submission_queue_;
       __task_queue __pending_{};
       __atomic_task_queue __requests_{};
       __wakeup_operation __wakeup_operation_;
+      std::atomic<std::ptrdiff_t> __load_{0};
+      std::span<__context* const> __peers_{};
+      std::size_t __peer_index_{0};
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+      std::unique_ptr<__msg_ring_operation[]> __msg_ring_ops_{};
+      bool __msg_ring_unsupported_{false};
+#    endif
+      void* __batch_{nullptr};
+      void (*__begin_batch_)(void*) noexcept = nullptr;
+      void (*__end_batch_)(void*) noexcept = nullptr;
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+      std::optional<__timer_queue> __timers_{};
+#    endif
     };
 
     inline void __wakeup_operation::start() & noexcept {
@@ -639,6 +1730,75 @@ namespace exec {
       }
     }
 
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+    inline void __timer_queue::__submit(__task* __task) noexcept {
+      __context_->__pending_.push_back(__task);
+    }
+
+    inline void __timer_queue::__update() noexcept {
+      if (__cancelling_) {
+        return;
+      }
+      __timer* __first = __heap_.front();
+      if (__armed_) {
+        if (__first == nullptr || __first->__deadline_ + __slack_ < __armed_until_) {
+          __cancelling_ = true;
+          __submit(&__cancel_op_);
+        }
+        return;
+      }
+      if (__first == nullptr || __context_->stop_requested()) {
+        return;
+      }
+      __armed_until_ = __first->__deadline_ + __slack_;
+      const auto __since_epoch = __armed_until_.time_since_epoch();
+      const auto __secs = std::chrono::duration_cast<std::chrono::seconds>(__since_epoch);
+      __timespec_ = __kernel_timespec{__secs.count(), (__since_epoch - __secs).count()};
+      __armed_ = true;
+      __submit(&__timeout_op_);
+    }
+#    endif
+
+#    ifdef STDEXEC_HAS_IORING_OP_MSG_RING
+    inline void
+      __msg_ring_operation::__submit_(__task* __pointer, ::io_uring_sqe& __entry) noexcept {
+      __msg_ring_operation& __self = *static_cast<__msg_ring_operation*>(__pointer);
+      __entry = ::io_uring_sqe{};
+      __entry.opcode = IORING_OP_MSG_RING;
+      __entry.fd = __self.__target_->__ring_fd_;
+      // The target ring receives a completion with this user data and a result of zero.
+      __entry.off = __msg_ring_wakeup_data;
+    }
+
+    inline void
+      __msg_ring_operation::__complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+      __msg_ring_operation& __self = *static_cast<__msg_ring_operation*>(__pointer);
+      __self.__in_flight_ = false;
+      if (__cqe.res < 0) {
+        // Either this context has been stopped or the kernel does not support messaging rings.
+        // We fall back to the eventfd of the target context in any case.
+        if (__cqe.res == -EINVAL) {
+          __self.__source_->__msg_ring_unsupported_ = true;
+        }
+        __self.__rearm_ = false;
+        __self.__target_->wakeup();
+      } else if (std::exchange(__self.__rearm_, false)) {
+        __self.start();
+      }
+    }
+
+    inline void __msg_ring_operation::start() noexcept {
+      // If a message is still in flight, the target may have consumed it before the new task was
+      // submitted. We send another message as soon as the current one has completed.
+      if (__in_flight_) {
+        __rearm_ = true;
+      } else {
+        __in_flight_ = true;
+        __source_->submit(this);
+      }
+    }
+#    endif
+
     template <class _Op>
     concept __io_task = //
       requires(_Op& __op, ::io_uring_sqe& __sqe, const ::io_uring_cqe& __cqe) {
@@ -703,7 +1863,7 @@ namespace exec {
       void start() & noexcept {
         __context& __context = __base_.context();
         if (__context.submit(this)) {
-          __context.wakeup();
+          __context.__wakeup_after_submit();
         }
       }
 
@@ -787,10 +1947,9 @@ namespace exec {
         }
 
         void complete(const ::io_uring_cqe&) noexcept {
+          // The operation itself has completed before; finish it with its own completion.
           if (__op_->__n_ops_.fetch_sub(1, std::memory_order_relaxed) == 1) {
-            __op_->__on_context_stop_.reset();
-            __op_->__on_receiver_stop_.reset();
-            stdexec::set_stopped((static_cast<_Base&&>(*__op_)).receiver());
+            __op_->__complete();
           }
         }
 
@@ -805,7 +1964,7 @@ namespace exec {
           int expected = 1;
           if (__op_->__n_ops_.compare_exchange_strong(expected, 2, std::memory_order_relaxed)) {
             if (__op_->context().submit(this)) {
-              __op_->context().wakeup();
+              __op_->context().__wakeup_after_submit();
             }
           }
         }
@@ -867,6 +2026,9 @@ namespace exec {
 
         stdexec::__t<__stop_operation<__impl>> __stop_operation_;
         std::atomic<int> __n_ops_{0};
+        // The result of the operation itself, which may complete before its stop operation.
+        __s32 __res_{0};
+        __u32 __flags_{0};
         __on_context_stop_t __on_context_stop_{};
         __on_receiver_stop_t __on_receiver_stop_{};
 
@@ -907,17 +2069,41 @@ namespace exec {
         }
 
         void complete(const ::io_uring_cqe& __cqe) noexcept {
+#    ifdef IORING_CQE_F_MORE
+          if constexpr (requires { this->__base_.complete_more(__cqe); }) {
+            if (__cqe.flags & IORING_CQE_F_MORE) {
+              this->__base_.complete_more(__cqe);
+              return;
+            }
+          }
+#    endif
+          // Both the operation and its stop operation complete on the thread of the context.
+          __res_ = __cqe.res;
+          __flags_ = __cqe.flags;
           if (__n_ops_.fetch_sub(1, std::memory_order_relaxed) == 1) {
-            __on_context_stop_.reset();
-            __on_receiver_stop_.reset();
-            _Receiver& __receiver = this->__base_.receiver();
-            __context& __context_ = this->__base_.context();
-            auto token = stdexec::get_stop_token(stdexec::get_env(__receiver));
-            if (__cqe.res == -ECANCELED || __context_.stop_requested() || token.stop_requested()) {
-              stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
+            __complete();
+          }
+        }
+
+        void __complete() noexcept {
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+          _Receiver& __receiver = this->__base_.receiver();
+          __context& __context_ = this->__base_.context();
+          auto token = stdexec::get_stop_token(stdexec::get_env(__receiver));
+          ::io_uring_cqe __cqe{};
+          __cqe.res = __res_;
+          __cqe.flags = __flags_;
+          if (__cqe.res == -ECANCELED || __context_.stop_requested() || token.stop_requested()) {
+            // The kernel may have completed the operation before the stop request reached it.
+            // Operations that own resources release them in complete_stopped().
+            if constexpr (requires { this->__base_.complete_stopped(__cqe); }) {
+              this->__base_.complete_stopped(__cqe);
             } else {
-              this->__base_.complete(__cqe);
+              stdexec::set_stopped(static_cast<_Receiver&&>(__receiver));
             }
+          } else {
+            this->__base_.complete(__cqe);
           }
         }
       };
@@ -1057,6 +2243,187 @@ namespace exec {
       using __t = __stoppable_task_facade_t<__impl>;
     };
 
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+    // A timer that waits in the timer queue of its context. Starting the timer and removing it
+    // after a stop request are both handed to the thread that drives the context as tasks that
+    // are ready right away.
+    template <class _ReceiverId>
+    struct __queued_timer_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t : __timer {
+        struct __cancel_task : __task {
+          __t* __parent_;
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return true;
+          }
+
+          static void __submit_(__task*, ::io_uring_sqe&) noexcept {
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+            static_cast<__cancel_task*>(__pointer)->__parent_->__cancel(__cqe.res);
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          explicit __cancel_task(__t* __parent) noexcept
+            : __task{__vtable}
+            , __parent_{__parent} {
+          }
+        };
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+
+        __context& __context_;
+        std::chrono::nanoseconds __duration_;
+        _Receiver __rcvr_;
+        __cancel_task __cancel_task_{this};
+        // One reference for the timer and one for a pending cancellation.
+        std::atomic<int> __n_ops_{0};
+        // Only accessed by the thread that drives the context.
+        bool __queued_{false};
+        bool __stopped_{false};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return true;
+        }
+
+        static void __submit_(__task*, ::io_uring_sqe&) noexcept {
+        }
+
+        // Inserts the timer into the timer queue unless it has been stopped before.
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto& __self = *static_cast<__t*>(__pointer);
+          if (__cqe.res == -ECANCELED || __self.__stopped_) {
+            __self.__stopped_ = true;
+            __self.__release();
+          } else {
+            __self.__queued_ = true;
+            __self.__context_.__timers()->insert(&__self);
+          }
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        static void __expire_(__timer* __pointer) noexcept {
+          static_cast<__t*>(__pointer)->__release();
+        }
+
+        void __request_stop() noexcept {
+          int __expected = 1;
+          if (__n_ops_.compare_exchange_strong(__expected, 2, std::memory_order_relaxed)) {
+            if (__context_.submit(&__cancel_task_)) {
+              __context_.__wakeup_after_submit();
+            }
+          }
+        }
+
+        // A timer that has already expired completes normally. A timer that has not been
+        // queued yet is released by its start task. A cancellation that completes with
+        // ECANCELED has been rejected by a context that is done; there is no timer queue to
+        // remove the timer from anymore.
+        void __cancel(int __res) noexcept {
+          if (__res != -ECANCELED) {
+            if (!__queued_) {
+              __stopped_ = true;
+            } else if (__context_.__timers()->erase(this)) {
+              __stopped_ = true;
+              __release();
+            }
+          }
+          __release();
+        }
+
+        // This operation must not be accessed after calling this function.
+        void __release() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+          auto __token = stdexec::get_stop_token(stdexec::get_env(__rcvr_));
+          if (__stopped_ || __context_.stop_requested() || __token.stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_));
+          }
+        }
+
+       public:
+        __t(__context& __context, std::chrono::nanoseconds __duration, _Receiver&& __rcvr)
+          : __timer{__vtable, &__expire_}
+          , __context_{__context}
+          , __duration_{__duration}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        void start() & noexcept {
+          this->__deadline_ = std::chrono::steady_clock::now() + __duration_;
+          __n_ops_.store(1, std::memory_order_relaxed);
+          __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
+          __on_receiver_stop_.emplace(
+            stdexec::get_stop_token(stdexec::get_env(__rcvr_)), __stop_callback{this});
+          if (__context_.submit(this)) {
+            __context_.__wakeup_after_submit();
+          }
+        }
+      };
+    };
+
+    // Waits in the timer queue of the context if it coalesces timers and with a kernel timeout
+    // of its own otherwise.
+    template <class _ReceiverId>
+    struct __timer_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      using __kernel_timer_t = stdexec::__t<__schedule_after_operation<_ReceiverId>>;
+      using __queued_timer_t = stdexec::__t<__queued_timer_operation<_ReceiverId>>;
+      using __variant_t = std::variant<__kernel_timer_t, __queued_timer_t>;
+
+      class __t {
+        __variant_t __timer_;
+
+        static auto __make_timer(
+          __context& __context,
+          std::chrono::nanoseconds __duration,
+          _Receiver&& __rcvr) -> __variant_t {
+          if (__context.__timers()) {
+            return __variant_t{
+              std::in_place_index<1>, __context, __duration, static_cast<_Receiver&&>(__rcvr)};
+          }
+          return __variant_t{
+            std::in_place_index<0>,
+            std::in_place,
+            __context,
+            __duration,
+            static_cast<_Receiver&&>(__rcvr)};
+        }
+
+       public:
+        __t(__context& __context, std::chrono::nanoseconds __duration, _Receiver&& __rcvr)
+          : __timer_{__make_timer(__context, __duration, static_cast<_Receiver&&>(__rcvr))} {
+        }
+
+        void start() & noexcept {
+          std::visit([](auto& __timer) noexcept { stdexec::start(__timer); }, __timer_);
+        }
+      };
+    };
+#    endif
+
     class __scheduler {
      public:
       __context* __context_;
@@ -1129,12 +2496,21 @@ namespace exec {
           return {};
         }
 
+#    ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+        template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        auto connect(_Receiver __receiver) const & //
+          -> stdexec::__t<__timer_operation<stdexec::__id<_Receiver>>> {
+          return stdexec::__t<__timer_operation<stdexec::__id<_Receiver>>>(
+            *__env_.__context_, __duration_, static_cast<_Receiver&&>(__receiver));
+        }
+#    else
         template <stdexec::receiver_of<__completion_sigs> _Receiver>
         auto connect(_Receiver __receiver) const & //
           -> stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>> {
           return stdexec::__t<__schedule_after_operation<stdexec::__id<_Receiver>>>(
             std::in_place, *__env_.__context_, __duration_, static_cast<_Receiver&&>(__receiver));
         }
+#    endif
       };
 
       auto schedule() const -> __schedule_sender {
@@ -1169,8 +2545,18 @@ namespace exec {
   } // namespace __io_uring
 
   using __io_uring::until;
+  using io_uring_context_options = __io_uring::__context_options;
+  using io_uring_statistics = __io_uring::__statistics;
+  using io_uring_opcode_statistics = __io_uring::__opcode_statistics;
+  using io_uring_latency_histogram = __io_uring::__latency_histogram;
   using io_uring_context = __io_uring::__context;
   using io_uring_scheduler = __io_uring::__scheduler;
+
+  /// Lets the system I/O backend hand out an `io_uring_context`.
+  template <>
+  struct system_context_replaceability::io_context_identifier<io_uring_context> {
+    static constexpr __uuid value{0x8e3b57c1d90a46f2, 0xa17f02c6e4d9b835};
+  };
 } // namespace exec
 
 #  endif // if __has_include(<linux/verison.h>)
@@ -0,0 +1,1262 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "./io_uring_context.hpp"
+#include "./safe_file_descriptor.hpp"
+#include "../with_deadline.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#ifdef STDEXEC_HAS_IORING_OP_OPENAT2
+#  include <linux/openat2.h>
+#endif
+
+namespace exec {
+#ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+  /// @brief The error of an io_uring_link chain one of whose stages transferred fewer bytes than
+  /// requested.
+  ///
+  /// The error code is std::errc::io_error. stage() is the position of the short stage among the
+  /// arguments of io_uring_link, counting io_uring_link_timeout() stages, too.
+  class io_uring_short_transfer : public std::system_error {
+   public:
+    explicit io_uring_short_transfer(std::size_t __stage)
+      : std::system_error(
+          std::make_error_code(std::errc::io_error),
+          "io_uring_link: stage " + std::to_string(__stage) + " was short")
+      , __stage_{__stage} {
+    }
+
+    [[nodiscard]]
+    auto stage() const noexcept -> std::size_t {
+      return __stage_;
+    }
+
+   private:
+    std::size_t __stage_;
+  };
+#endif
+
+  namespace __io_uring {
+    // An io operation describes a single submission queue entry. It provides
+    //
+    //   void prepare(::io_uring_sqe&) noexcept;
+    //   auto result(const ::io_uring_cqe&) noexcept -> __result_t;
+    //
+    // where __result_t is a std::tuple of the values that the operation completes with if the
+    // result of its completion is not negative.
+    //
+    // Operations that post more than one completion also provide
+    //
+    //   void more(const ::io_uring_cqe&) noexcept;
+    //   auto status(const ::io_uring_cqe&) noexcept -> int;
+    //
+    // more() is called for each completion that has IORING_CQE_F_MORE set. status() returns the
+    // result of the whole operation once its last completion has arrived.
+    //
+    // Operations that own a resource may also provide
+    //
+    //   void finish(int __res) noexcept;
+    //
+    // which is called with the result of the operation before the receiver is completed, also if
+    // the receiver is completed with set_stopped(). If an operation succeeded but its receiver is
+    // not completed with its values, e.g. because it has been stopped, the values are created and
+    // destroyed, so that values that own resources, like an opened file descriptor, release them.
+    template <class _Op>
+    concept __io_operation = //
+      requires(_Op& __op, ::io_uring_sqe& __sqe, const ::io_uring_cqe& __cqe) {
+        typename _Op::__result_t;
+        { __op.prepare(__sqe) } noexcept;
+        { __op.result(__cqe) } noexcept -> std::same_as<typename _Op::__result_t>;
+      };
+
+    template <class _Tuple>
+    struct __set_value_sig;
+
+    template <class... _Ts>
+    struct __set_value_sig<std::tuple<_Ts...>> {
+      using __t = stdexec::set_value_t(_Ts...);
+    };
+
+    template <class _Op>
+    concept __multishot_io_operation = //
+      __io_operation<_Op> &&           //
+      requires(_Op& __op, const ::io_uring_cqe& __cqe) {
+        { __op.more(__cqe) } noexcept;
+        { __op.status(__cqe) } noexcept -> std::same_as<int>;
+      };
+
+    template <class _Op>
+    auto __status_of(_Op& __op, const ::io_uring_cqe& __cqe) noexcept -> int {
+      if constexpr (__multishot_io_operation<_Op>) {
+        return __op.status(__cqe);
+      } else {
+        return __cqe.res;
+      }
+    }
+
+    inline auto __io_error(int __res) noexcept -> std::exception_ptr {
+      return std::make_exception_ptr(std::system_error(-__res, std::system_category()));
+    }
+
+    struct __read_operation {
+      using __result_t = std::tuple<std::size_t>;
+
+      int __fd_;
+      std::span<std::byte> __buffer_;
+      ::off_t __offset_;
+#ifndef STDEXEC_HAS_IORING_OP_READ
+      ::iovec __iov_{};
+#endif
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.fd = __fd_;
+        __sqe_.off = static_cast<__u64>(__offset_);
+#ifdef STDEXEC_HAS_IORING_OP_READ
+        __sqe_.opcode = IORING_OP_READ;
+        __sqe_.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe_.len = static_cast<__u32>(__buffer_.size());
+#else
+        __iov_ = ::iovec{__buffer_.data(), __buffer_.size()};
+        __sqe_.opcode = IORING_OP_READV;
+        __sqe_.addr = bit_cast<__u64>(&__iov_);
+        __sqe_.len = 1;
+#endif
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<std::size_t>(__cqe.res)};
+      }
+    };
+
+    struct __write_operation {
+      using __result_t = std::tuple<std::size_t>;
+
+      int __fd_;
+      std::span<const std::byte> __buffer_;
+      ::off_t __offset_;
+#ifndef STDEXEC_HAS_IORING_OP_READ
+      ::iovec __iov_{};
+#endif
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.fd = __fd_;
+        __sqe_.off = static_cast<__u64>(__offset_);
+#ifdef STDEXEC_HAS_IORING_OP_READ
+        __sqe_.opcode = IORING_OP_WRITE;
+        __sqe_.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe_.len = static_cast<__u32>(__buffer_.size());
+#else
+        __iov_ = ::iovec{const_cast<std::byte*>(__buffer_.data()), __buffer_.size()};
+        __sqe_.opcode = IORING_OP_WRITEV;
+        __sqe_.addr = bit_cast<__u64>(&__iov_);
+        __sqe_.len = 1;
+#endif
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<std::size_t>(__cqe.res)};
+      }
+    };
+
+    struct __fsync_operation {
+      using __result_t = std::tuple<>;
+
+      int __fd_;
+      bool __data_only_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_FSYNC;
+        __sqe_.fd = __fd_;
+        __sqe_.fsync_flags = __data_only_ ? IORING_FSYNC_DATASYNC : 0u;
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+
+    inline void __set_poll_events(::io_uring_sqe& __sqe, unsigned __events) noexcept {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 9, 0)
+      // The kernel expects the two halves of the mask in swapped order on big endian machines.
+      if constexpr (std::endian::native == std::endian::big) {
+        __events = (__events << 16) | (__events >> 16);
+      }
+      __sqe.poll32_events = __events;
+#else
+      __sqe.poll_events = static_cast<__u16>(__events);
+#endif
+    }
+
+    struct __poll_operation {
+      using __result_t = std::tuple<unsigned>;
+
+      int __fd_;
+      unsigned __events_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_POLL_ADD;
+        __sqe_.fd = __fd_;
+        __io_uring::__set_poll_events(__sqe_, __events_);
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<unsigned>(__cqe.res)};
+      }
+    };
+
+#ifdef STDEXEC_HAS_IORING_OP_OPENAT2
+    struct __openat2_operation {
+      using __result_t = std::tuple<safe_file_descriptor>;
+
+      int __dirfd_;
+      std::string __path_;
+      ::open_how __how_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_OPENAT2;
+        __sqe_.fd = __dirfd_;
+        __sqe_.addr = bit_cast<__u64>(__path_.c_str());
+        __sqe_.len = sizeof(::open_how);
+        __sqe_.off = bit_cast<__u64>(&__how_);
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{safe_file_descriptor{__cqe.res}};
+      }
+    };
+
+    // The operation owns the file descriptor until the kernel has processed the request. If
+    // the operation is canceled before, the file descriptor is closed synchronously when the
+    // operation is destroyed.
+    struct __close_operation {
+      using __result_t = std::tuple<>;
+
+      safe_file_descriptor __fd_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_CLOSE;
+        __sqe_.fd = __fd_.native_handle();
+        __sqe = __sqe_;
+      }
+
+      void finish(int __res) noexcept {
+        // The kernel releases the file descriptor even if the file fails to flush.
+        if (__res != -ECANCELED) {
+          [[maybe_unused]] int __fd = __fd_.release();
+        }
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+
+    struct __fallocate_operation {
+      using __result_t = std::tuple<>;
+
+      int __fd_;
+      int __mode_;
+      ::off_t __offset_;
+      ::off_t __length_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_FALLOCATE;
+        __sqe_.fd = __fd_;
+        __sqe_.off = static_cast<__u64>(__offset_);
+        __sqe_.addr = static_cast<__u64>(__length_);
+        __sqe_.len = static_cast<__u32>(__mode_);
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+
+    struct __statx_operation {
+      using __result_t = std::tuple<struct ::statx>;
+
+      int __dirfd_;
+      std::string __path_;
+      int __flags_;
+      unsigned __mask_;
+      struct ::statx __buffer_ {};
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_STATX;
+        __sqe_.fd = __dirfd_;
+        __sqe_.addr = bit_cast<__u64>(__path_.c_str());
+        __sqe_.len = __mask_;
+        __sqe_.off = bit_cast<__u64>(&__buffer_);
+        __sqe_.statx_flags = static_cast<__u32>(__flags_);
+        __sqe = __sqe_;
+      }
+
+      auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return __result_t{__buffer_};
+      }
+    };
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_RENAMEAT
+    struct __renameat_operation {
+      using __result_t = std::tuple<>;
+
+      int __old_dirfd_;
+      std::string __old_path_;
+      int __new_dirfd_;
+      std::string __new_path_;
+      unsigned __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_RENAMEAT;
+        __sqe_.fd = __old_dirfd_;
+        __sqe_.addr = bit_cast<__u64>(__old_path_.c_str());
+        __sqe_.len = static_cast<__u32>(__new_dirfd_);
+        __sqe_.addr2 = bit_cast<__u64>(__new_path_.c_str());
+        __sqe_.rename_flags = __flags_;
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+
+    struct __unlinkat_operation {
+      using __result_t = std::tuple<>;
+
+      int __dirfd_;
+      std::string __path_;
+      int __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_UNLINKAT;
+        __sqe_.fd = __dirfd_;
+        __sqe_.addr = bit_cast<__u64>(__path_.c_str());
+        __sqe_.unlink_flags = static_cast<__u32>(__flags_);
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+#endif
+
+#ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+    // A pseudo stage of a linked chain. It fails the stage that precedes it in the chain with
+    // std::errc::timed_out if that stage does not complete within the given duration.
+    struct __link_timeout {
+      using __result_t = std::tuple<>;
+
+      struct __kernel_timespec {
+        __s64 __tv_sec;
+        __s64 __tv_nsec;
+      };
+
+      __kernel_timespec __duration_;
+
+      explicit __link_timeout(std::chrono::nanoseconds __duration) noexcept {
+        auto __secs = std::chrono::duration_cast<std::chrono::seconds>(__duration);
+        __duration -= __secs;
+        __secs = std::max(__secs, std::chrono::seconds{0});
+        __duration = std::clamp(
+          __duration, std::chrono::nanoseconds{0}, std::chrono::nanoseconds{999'999'999});
+        __duration_ = __kernel_timespec{__secs.count(), __duration.count()};
+      }
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_LINK_TIMEOUT;
+        __sqe_.addr = bit_cast<__u64>(&__duration_);
+        __sqe_.len = 1;
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe&) noexcept -> __result_t {
+        return {};
+      }
+    };
+
+    template <bool _StopOnTimeout, class... _Ops>
+    struct __link_sender;
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_SPLICE
+    // Moves data between two file descriptors, one of which must be a pipe, without copying it
+    // through user space. An offset of -1 uses and updates the file position instead.
+    struct __splice_operation {
+      using __result_t = std::tuple<std::size_t>;
+
+      int __fd_in_;
+      ::off_t __offset_in_;
+      int __fd_out_;
+      ::off_t __offset_out_;
+      std::size_t __length_;
+      unsigned __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_SPLICE;
+        __sqe_.fd = __fd_out_;
+        __sqe_.off = static_cast<__u64>(__offset_out_);
+        __sqe_.splice_fd_in = __fd_in_;
+        __sqe_.splice_off_in = static_cast<__u64>(__offset_in_);
+        __sqe_.len = static_cast<__u32>(__length_);
+        __sqe_.splice_flags = __flags_;
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<std::size_t>(__cqe.res)};
+      }
+    };
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_TEE
+    // Duplicates data from one pipe into another without consuming it.
+    struct __tee_operation {
+      using __result_t = std::tuple<std::size_t>;
+
+      int __fd_in_;
+      int __fd_out_;
+      std::size_t __length_;
+      unsigned __flags_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_TEE;
+        __sqe_.fd = __fd_out_;
+        __sqe_.splice_fd_in = __fd_in_;
+        __sqe_.len = static_cast<__u32>(__length_);
+        __sqe_.splice_flags = __flags_;
+        __sqe = __sqe_;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<std::size_t>(__cqe.res)};
+      }
+    };
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+    // Sends a buffer without copying it into the kernel. The kernel posts the number of bytes
+    // sent first and a notification with IORING_CQE_F_NOTIF once it no longer references the
+    // buffer. The operation completes after the notification.
+    struct __send_zc_operation {
+      using __result_t = std::tuple<std::size_t>;
+
+      int __fd_;
+      std::span<const std::byte> __buffer_;
+      int __flags_;
+      int __res_{0};
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_SEND_ZC;
+        __sqe_.fd = __fd_;
+        __sqe_.addr = bit_cast<__u64>(__buffer_.data());
+        __sqe_.len = static_cast<__u32>(__buffer_.size());
+        __sqe_.msg_flags = static_cast<__u32>(__flags_);
+        __sqe = __sqe_;
+      }
+
+      void more(const ::io_uring_cqe& __cqe) noexcept {
+        if (!(__cqe.flags & IORING_CQE_F_NOTIF)) {
+          __res_ = __cqe.res;
+        }
+      }
+
+      auto status(const ::io_uring_cqe& __cqe) noexcept -> int {
+        // Without a notification the first completion is the only one.
+        return (__cqe.flags & IORING_CQE_F_NOTIF) ? __res_ : __cqe.res;
+      }
+
+      auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<std::size_t>(status(__cqe))};
+      }
+    };
+#endif
+
+    template <class _ReceiverId, class _Op>
+    struct __io_sender_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __impl : public __stoppable_op_base<_Receiver> {
+        _Op __op_;
+
+       public:
+        __impl(__context& __context, _Op __op, _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __op_{static_cast<_Op&&>(__op)} {
+        }
+
+        static constexpr auto ready() noexcept -> std::false_type {
+          return {};
+        }
+
+        void submit(::io_uring_sqe& __sqe) noexcept {
+          __op_.prepare(__sqe);
+        }
+
+        void complete_more(const ::io_uring_cqe& __cqe) noexcept
+          requires __multishot_io_operation<_Op>
+        {
+          __op_.more(__cqe);
+        }
+
+        void complete(const ::io_uring_cqe& __cqe) noexcept {
+          const int __res = __io_uring::__status_of(__op_, __cqe);
+          if constexpr (requires { __op_.finish(__res); }) {
+            __op_.finish(__res);
+          }
+          if (__res == -ECANCELED) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+          } else if (__res >= 0) {
+            std::apply(
+              [this]<class... _Values>(_Values&&... __values) noexcept {
+                stdexec::set_value(
+                  static_cast<_Receiver&&>(this->__receiver_), static_cast<_Values&&>(__values)...);
+              },
+              __op_.result(__cqe));
+          } else {
+            stdexec::set_error(static_cast<_Receiver&&>(this->__receiver_), __io_error(__res));
+          }
+        }
+
+        void complete_stopped(const ::io_uring_cqe& __cqe) noexcept {
+          const int __res = __io_uring::__status_of(__op_, __cqe);
+          if constexpr (requires { __op_.finish(__res); }) {
+            __op_.finish(__res);
+          }
+          if (__res >= 0) {
+            [[maybe_unused]] typename _Op::__result_t __discarded = __op_.result(__cqe);
+          }
+          stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+        }
+      };
+
+      using __t = __stoppable_task_facade_t<__impl>;
+    };
+
+    // A sender that submits a single io operation to the io_uring of a context.
+    template <__io_operation _Op>
+    struct __io_sender {
+      using __completion_sigs = stdexec::completion_signatures<
+        typename __set_value_sig<typename _Op::__result_t>::__t,
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()>;
+
+      using sender_concept = stdexec::sender_t;
+      using __id = __io_sender;
+      using __t = __io_sender;
+
+      __scheduler::__schedule_env __env_;
+      _Op __op_;
+
+      auto get_env() const noexcept -> __scheduler::__schedule_env {
+        return __env_;
+      }
+
+      template <class... _Env>
+      static auto get_completion_signatures(const __io_sender&, _Env&&...) noexcept
+        -> __completion_sigs {
+        return {};
+      }
+
+      template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        requires std::copy_constructible<_Op>
+      auto connect(_Receiver __receiver) const & //
+        -> stdexec::__t<__io_sender_operation<stdexec::__id<_Receiver>, _Op>> {
+        return stdexec::__t<__io_sender_operation<stdexec::__id<_Receiver>, _Op>>(
+          std::in_place, *__env_.__context_, __op_, static_cast<_Receiver&&>(__receiver));
+      }
+
+      template <stdexec::receiver_of<__completion_sigs> _Receiver>
+      auto connect(_Receiver __receiver) && //
+        -> stdexec::__t<__io_sender_operation<stdexec::__id<_Receiver>, _Op>> {
+        return stdexec::__t<__io_sender_operation<stdexec::__id<_Receiver>, _Op>>(
+          std::in_place,
+          *__env_.__context_,
+          static_cast<_Op&&>(__op_),
+          static_cast<_Receiver&&>(__receiver));
+      }
+
+#ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+     private:
+      // The deadline is a linked timeout in the same submission as the operation itself.
+      template <class _Rep, class _Period>
+      friend auto tag_invoke(
+        with_deadline_t,
+        const __io_sender& __self,
+        std::chrono::duration<_Rep, _Period> __duration) noexcept
+        -> __link_sender<true, _Op, __link_timeout> {
+        return {__self.__env_, {__self.__op_, __link_timeout{__duration}}};
+      }
+#endif
+    };
+
+#ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+    template <class _Stage>
+    inline constexpr bool __is_link_timeout = stdexec::same_as<_Stage, __link_timeout>;
+
+    template <class _Stage>
+    struct __stage_operation {
+      using __t = _Stage;
+    };
+
+    template <class _Op>
+    struct __stage_operation<__io_sender<_Op>> {
+      using __t = _Op;
+    };
+
+    template <class _Stage>
+    using __stage_operation_t = typename __stage_operation<_Stage>::__t;
+
+    // Submits all stages as one chain of linked submission queue entries. The operation
+    // completes with the concatenated values of all stages or with the error of the first stage
+    // that failed. If _StopOnTimeout is true, a stage that misses its deadline completes the
+    // operation with set_stopped() instead of an error.
+    template <class _ReceiverId, bool _StopOnTimeout, class... _Ops>
+    struct __link_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+      static constexpr std::size_t __n_stages = sizeof...(_Ops);
+
+      class __t;
+
+      // A single submission queue entry of the chain.
+      struct __stage : __task {
+        __t* __parent_;
+        std::size_t __index_;
+
+        __stage(const __task_vtable& __vtable, __t* __parent, std::size_t __index) noexcept
+          : __task{__vtable}
+          , __parent_{__parent}
+          , __index_{__index} {
+        }
+      };
+
+      // Cancels the first stage that did not complete yet. Canceling a stage fails all stages
+      // that are linked after it.
+      struct __cancel_operation : __task {
+        __t* __parent_;
+        std::size_t __target_{__n_stages};
+
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto& __self = *static_cast<__cancel_operation*>(__pointer);
+          __self.__target_ = __self.__parent_->__first_incomplete_stage();
+          ::io_uring_sqe __sqe_{};
+          if (__self.__target_ == __n_stages) {
+            __sqe_.opcode = IORING_OP_NOP;
+          } else {
+            __sqe_.opcode = IORING_OP_ASYNC_CANCEL;
+            __task* __stage = &__self.__parent_->__stages_[__self.__target_];
+            __sqe_.addr = bit_cast<__u64>(__stage);
+          }
+          __sqe = __sqe_;
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto& __self = *static_cast<__cancel_operation*>(__pointer);
+          // The target may have completed before the cancellation reached it. Cancel the next
+          // stage of the chain in this case.
+          if (
+            __cqe.res == -ENOENT && __self.__target_ != __n_stages
+            && __self.__parent_->__first_incomplete_stage() != __n_stages) {
+            __self.__parent_->context().submit(&__self);
+          } else {
+            __self.__parent_->__complete_one();
+          }
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        explicit __cancel_operation(__t* __parent) noexcept
+          : __task{__vtable}
+          , __parent_{__parent} {
+        }
+      };
+
+      class __t : public __stoppable_op_base<_Receiver> {
+        friend struct __cancel_operation;
+
+        static constexpr bool __is_timeout_stage_[] = {__is_link_timeout<_Ops>...};
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+
+        std::tuple<_Ops...> __ops_;
+        ::io_uring_cqe __cqes_[__n_stages]{};
+        bool __completed_[__n_stages]{};
+        std::atomic<int> __n_ops_{0};
+        std::atomic<bool> __stop_requested_{false};
+        __cancel_operation __cancel_operation_{this};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+        __stage __stages_[__n_stages];
+
+        template <std::size_t _Ip>
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        template <std::size_t _Ip>
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          __t& __self = *static_cast<__stage*>(__pointer)->__parent_;
+          if constexpr (_Ip == 0) {
+            __self.__start_chain();
+          }
+          std::get<_Ip>(__self.__ops_).prepare(__sqe);
+        }
+
+        template <std::size_t _Ip>
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          __t& __self = *static_cast<__stage*>(__pointer)->__parent_;
+#ifdef IORING_CQE_F_MORE
+          if constexpr (__multishot_io_operation<std::tuple_element_t<_Ip, std::tuple<_Ops...>>>) {
+            if (__cqe.flags & IORING_CQE_F_MORE) {
+              std::get<_Ip>(__self.__ops_).more(__cqe);
+              return;
+            }
+          }
+#endif
+          __self.__cqes_[_Ip] = __cqe;
+          __self.__completed_[_Ip] = true;
+          __self.__complete_one();
+        }
+
+        template <std::size_t _Ip>
+        static auto __link_next_(__task* __pointer) noexcept -> __task* {
+          if constexpr (_Ip + 1 < __n_stages) {
+            return &static_cast<__stage*>(__pointer)->__parent_->__stages_[_Ip + 1];
+          } else {
+            return nullptr;
+          }
+        }
+
+        template <std::size_t _Ip>
+        static constexpr __task_vtable __stage_vtable{
+          &__ready_<_Ip>,
+          &__submit_<_Ip>,
+          &__complete_<_Ip>,
+          &__link_next_<_Ip>};
+
+        template <std::size_t... _Is>
+        __t(
+          std::index_sequence<_Is...>,
+          __context& __context,
+          std::tuple<_Ops...>&& __ops,
+          _Receiver&& __receiver)
+          : __stoppable_op_base<_Receiver>{__context, static_cast<_Receiver&&>(__receiver)}
+          , __ops_{static_cast<std::tuple<_Ops...>&&>(__ops)}
+          , __stages_{{__stage_vtable<_Is>, this, _Is}...} {
+        }
+
+        auto __first_incomplete_stage() const noexcept -> std::size_t {
+          std::size_t __index = 0;
+          while (__index < __n_stages && __completed_[__index]) {
+            ++__index;
+          }
+          return __index;
+        }
+
+        void __start_chain() noexcept {
+          __n_ops_.store(static_cast<int>(__n_stages), std::memory_order_relaxed);
+          __on_context_stop_.emplace(this->__context_.get_stop_token(), __stop_callback{this});
+          __on_receiver_stop_.emplace(
+            stdexec::get_stop_token(stdexec::get_env(this->__receiver_)), __stop_callback{this});
+        }
+
+        void __request_stop() noexcept {
+          if (__stop_requested_.exchange(true, std::memory_order_relaxed)) {
+            return;
+          }
+          int __n = __n_ops_.load(std::memory_order_relaxed);
+          while (__n > 0
+                 && !__n_ops_.compare_exchange_weak(
+                   __n, __n + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+            ;
+          if (__n > 0 && this->__context_.submit(&__cancel_operation_)) {
+            this->__context_.__wakeup_after_submit();
+          }
+        }
+
+        void __complete_one() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_relaxed) == 1) {
+            __on_context_stop_.reset();
+            __on_receiver_stop_.reset();
+            __complete();
+          }
+        }
+
+        void __complete() noexcept {
+          __finish(std::index_sequence_for<_Ops...>{});
+          auto __token = stdexec::get_stop_token(stdexec::get_env(this->__receiver_));
+          if (
+            __stop_requested_.load(std::memory_order_relaxed)
+            || this->__context_.stop_requested() || __token.stop_requested()) {
+            __discard(std::index_sequence_for<_Ops...>{});
+            stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+            return;
+          }
+          std::size_t __failed = 0;
+          if (int __res = __first_error(std::index_sequence_for<_Ops...>{}, __failed); __res < 0) {
+            __discard(std::index_sequence_for<_Ops...>{});
+            if (_StopOnTimeout && __res == -ETIMEDOUT) {
+              stdexec::set_stopped(static_cast<_Receiver&&>(this->__receiver_));
+              return;
+            }
+            if (__res == -ECANCELED && __failed != 0) {
+              // Nobody asked to stop the chain, so the kernel canceled the rest of it because
+              // the stage before transferred fewer bytes than requested.
+              stdexec::set_error(
+                static_cast<_Receiver&&>(this->__receiver_), __short_transfer(__failed));
+              return;
+            }
+            stdexec::set_error(static_cast<_Receiver&&>(this->__receiver_), __io_error(__res));
+            return;
+          }
+          std::apply(
+            [this]<class... _Values>(_Values&&... __values) noexcept {
+              stdexec::set_value(
+                static_cast<_Receiver&&>(this->__receiver_), static_cast<_Values&&>(__values)...);
+            },
+            __values(std::index_sequence_for<_Ops...>{}));
+        }
+
+        template <std::size_t... _Is>
+        void __finish(std::index_sequence<_Is...>) noexcept {
+          (__finish_stage<_Is>(), ...);
+        }
+
+        template <std::size_t _Ip>
+        void __finish_stage() noexcept {
+          auto& __op = std::get<_Ip>(__ops_);
+          const int __res = __io_uring::__status_of(__op, __cqes_[_Ip]);
+          if constexpr (requires { __op.finish(__res); }) {
+            __op.finish(__res);
+          }
+        }
+
+        // Creates and destroys the values of the stages that succeeded if the receiver does not
+        // get them, so that values that own resources release them.
+        template <std::size_t... _Is>
+        void __discard(std::index_sequence<_Is...>) noexcept {
+          (__discard_stage<_Is>(), ...);
+        }
+
+        template <std::size_t _Ip>
+        void __discard_stage() noexcept {
+          auto& __op = std::get<_Ip>(__ops_);
+          if (__io_uring::__status_of(__op, __cqes_[_Ip]) >= 0) {
+            [[maybe_unused]] auto __discarded = __op.result(__cqes_[_Ip]);
+          }
+        }
+
+        // Returns the negative result of the first stage that failed and stores its index, or
+        // returns zero. A stage that has been interrupted by its link timeout fails with
+        // -ETIMEDOUT.
+        template <std::size_t... _Is>
+        auto __first_error(std::index_sequence<_Is...>, std::size_t& __index) noexcept -> int {
+          int __res = 0;
+          ((__res < 0 ? void() : void((__res = __stage_error<_Is>(), __index = _Is))), ...);
+          return __res;
+        }
+
+        // Creates the error for a chain that has been cut short before the stage with the given
+        // index. The short stage is the closest preceding stage that is not a link timeout.
+        static auto __short_transfer(std::size_t __canceled) noexcept -> std::exception_ptr {
+          std::size_t __index = __canceled - 1;
+          while (__is_timeout_stage_[__index]) {
+            --__index;
+          }
+          return std::make_exception_ptr(io_uring_short_transfer(__index));
+        }
+
+        template <std::size_t _Ip>
+        auto __stage_error() noexcept -> int {
+          if constexpr (__is_link_timeout<std::tuple_element_t<_Ip, std::tuple<_Ops...>>>) {
+            return 0;
+          } else {
+            int __res = std::min(__io_uring::__status_of(std::get<_Ip>(__ops_), __cqes_[_Ip]), 0);
+            if constexpr (_Ip + 1 < __n_stages) {
+              if constexpr (__is_link_timeout<
+                              std::tuple_element_t<_Ip + 1, std::tuple<_Ops...>>>) {
+                if (__res < 0 && __cqes_[_Ip + 1].res == -ETIME) {
+                  __res = -ETIMEDOUT;
+                }
+              }
+            }
+            return __res;
+          }
+        }
+
+        template <std::size_t... _Is>
+        auto __values(std::index_sequence<_Is...>) noexcept {
+          return std::tuple_cat(std::get<_Is>(__ops_).result(__cqes_[_Is])...);
+        }
+
+       public:
+        __t(__context& __context, std::tuple<_Ops...>&& __ops, _Receiver&& __receiver)
+          : __t(
+              std::index_sequence_for<_Ops...>{},
+              __context,
+              static_cast<std::tuple<_Ops...>&&>(__ops),
+              static_cast<_Receiver&&>(__receiver)) {
+        }
+
+        void start() & noexcept {
+          if (this->__context_.submit(&__stages_[0])) {
+            this->__context_.__wakeup_after_submit();
+          }
+        }
+      };
+    };
+
+    template <bool _StopOnTimeout, class... _Ops>
+    struct __link_sender {
+      using __values_t = decltype(std::tuple_cat(std::declval<typename _Ops::__result_t>()...));
+
+      using __completion_sigs = stdexec::completion_signatures<
+        typename __set_value_sig<__values_t>::__t,
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()>;
+
+      using sender_concept = stdexec::sender_t;
+      using __id = __link_sender;
+      using __t = __link_sender;
+
+      __scheduler::__schedule_env __env_;
+      std::tuple<_Ops...> __ops_;
+
+      auto get_env() const noexcept -> __scheduler::__schedule_env {
+        return __env_;
+      }
+
+      template <class... _Env>
+      static auto get_completion_signatures(const __link_sender&, _Env&&...) noexcept
+        -> __completion_sigs {
+        return {};
+      }
+
+      template <stdexec::receiver_of<__completion_sigs> _Receiver>
+        requires(std::copy_constructible<_Ops> && ...)
+      auto connect(_Receiver __receiver) const & //
+        -> stdexec::__t<__link_operation<stdexec::__id<_Receiver>, _StopOnTimeout, _Ops...>> {
+        return {
+          *__env_.__context_, std::tuple<_Ops...>{__ops_}, static_cast<_Receiver&&>(__receiver)};
+      }
+
+      template <stdexec::receiver_of<__completion_sigs> _Receiver>
+      auto connect(_Receiver __receiver) && //
+        -> stdexec::__t<__link_operation<stdexec::__id<_Receiver>, _StopOnTimeout, _Ops...>> {
+        return {
+          *__env_.__context_,
+          static_cast<std::tuple<_Ops...>&&>(__ops_),
+          static_cast<_Receiver&&>(__receiver)};
+      }
+    };
+
+    template <class _Stage>
+    auto __get_stage_operation(_Stage&& __stage)
+      -> __stage_operation_t<stdexec::__decay_t<_Stage>> {
+      if constexpr (__is_link_timeout<stdexec::__decay_t<_Stage>>) {
+        return static_cast<_Stage&&>(__stage);
+      } else {
+        return static_cast<_Stage&&>(__stage).__op_;
+      }
+    }
+
+    template <class _Stage>
+    inline constexpr bool __is_io_sender = false;
+
+    template <class _Op>
+    inline constexpr bool __is_io_sender<__io_sender<_Op>> = true;
+
+    // A link timeout bounds the io stage right before it, so it may neither start a chain nor
+    // follow another link timeout.
+    template <class... _Stages>
+    constexpr auto __link_timeouts_follow_io_stages() noexcept -> bool {
+      constexpr bool __is_timeout[] = {__is_link_timeout<_Stages>...};
+      for (std::size_t __i = 0; __i < sizeof...(_Stages); ++__i) {
+        if (__is_timeout[__i] && (__i == 0 || __is_timeout[__i - 1])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template <class _First, class... _Stages>
+    concept __valid_link_chain =                                           //
+      __is_io_sender<_First>                                               //
+      && ((__is_io_sender<_Stages> || __is_link_timeout<_Stages>) && ...) //
+      && __link_timeouts_follow_io_stages<_First, _Stages...>();
+#endif
+  } // namespace __io_uring
+
+  /// @brief Reads from the file descriptor at the given offset into the buffer.
+  ///
+  /// Completes with the number of bytes that have been read.
+  inline auto io_uring_read(
+    io_uring_scheduler __sched,
+    int __fd,
+    std::span<std::byte> __buffer,
+    ::off_t __offset = 0) noexcept -> __io_uring::__io_sender<__io_uring::__read_operation> {
+    return {{__sched.__context_}, {__fd, __buffer, __offset}};
+  }
+
+  /// @brief Writes the buffer to the file descriptor at the given offset.
+  ///
+  /// Completes with the number of bytes that have been written.
+  inline auto io_uring_write(
+    io_uring_scheduler __sched,
+    int __fd,
+    std::span<const std::byte> __buffer,
+    ::off_t __offset = 0) noexcept -> __io_uring::__io_sender<__io_uring::__write_operation> {
+    return {{__sched.__context_}, {__fd, __buffer, __offset}};
+  }
+
+  /// @brief Flushes the file descriptor to its storage device.
+  ///
+  /// If data_only is true, metadata is only flushed if it is needed to read the data back.
+  inline auto
+    io_uring_fsync(io_uring_scheduler __sched, int __fd, bool __data_only = false) noexcept
+    -> __io_uring::__io_sender<__io_uring::__fsync_operation> {
+    return {{__sched.__context_}, {__fd, __data_only}};
+  }
+
+  /// @brief Waits until the file descriptor is ready for one of the given poll(2) events.
+  ///
+  /// Completes with the events that are ready. This works for any file descriptor that
+  /// supports poll(2), including the ones that io_uring has no dedicated operations for.
+  inline auto io_uring_poll(io_uring_scheduler __sched, int __fd, unsigned __events) noexcept
+    -> __io_uring::__io_sender<__io_uring::__poll_operation> {
+    return {{__sched.__context_}, {__fd, __events}};
+  }
+
+#ifdef STDEXEC_HAS_IORING_OP_OPENAT2
+  /// @brief Opens the file at the given path like openat(2).
+  ///
+  /// A relative path is resolved relative to the directory dirfd. Completes with the new file
+  /// descriptor.
+  inline auto io_uring_open(
+    io_uring_scheduler __sched,
+    std::string __path,
+    int __flags,
+    ::mode_t __mode = 0,
+    int __dirfd = AT_FDCWD) -> __io_uring::__io_sender<__io_uring::__openat2_operation> {
+    ::open_how __how{};
+    __how.flags = static_cast<__u64>(__flags);
+    // The kernel rejects a mode unless the file may be created.
+    if (__flags & (O_CREAT | O_TMPFILE)) {
+      __how.mode = __mode;
+    }
+    return {{__sched.__context_}, {__dirfd, static_cast<std::string&&>(__path), __how}};
+  }
+
+  /// @brief Closes the file descriptor.
+  inline auto io_uring_close(io_uring_scheduler __sched, safe_file_descriptor __fd) noexcept
+    -> __io_uring::__io_sender<__io_uring::__close_operation> {
+    return {{__sched.__context_}, {static_cast<safe_file_descriptor&&>(__fd)}};
+  }
+
+  /// @brief Manipulates the allocated disk space of the file like fallocate(2).
+  inline auto io_uring_fallocate(
+    io_uring_scheduler __sched,
+    int __fd,
+    ::off_t __offset,
+    ::off_t __length,
+    int __mode = 0) noexcept -> __io_uring::__io_sender<__io_uring::__fallocate_operation> {
+    return {{__sched.__context_}, {__fd, __mode, __offset, __length}};
+  }
+
+  /// @brief Queries the status of the file at the given path like statx(2).
+  ///
+  /// Completes with the struct statx of the file.
+  inline auto io_uring_statx(
+    io_uring_scheduler __sched,
+    std::string __path,
+    unsigned __mask = STATX_BASIC_STATS,
+    int __flags = 0,
+    int __dirfd = AT_FDCWD) -> __io_uring::__io_sender<__io_uring::__statx_operation> {
+    return {{__sched.__context_}, {__dirfd, static_cast<std::string&&>(__path), __flags, __mask}};
+  }
+
+  /// @brief Queries the status of the open file descriptor like statx(2) with AT_EMPTY_PATH.
+  inline auto io_uring_statx(
+    io_uring_scheduler __sched,
+    int __fd,
+    unsigned __mask = STATX_BASIC_STATS) -> __io_uring::__io_sender<__io_uring::__statx_operation> {
+    return {{__sched.__context_}, {__fd, std::string{}, AT_EMPTY_PATH, __mask}};
+  }
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_RENAMEAT
+  /// @brief Renames a file like renameat2(2).
+  inline auto io_uring_rename(
+    io_uring_scheduler __sched,
+    std::string __old_path,
+    std::string __new_path,
+    unsigned __flags = 0,
+    int __old_dirfd = AT_FDCWD,
+    int __new_dirfd = AT_FDCWD) -> __io_uring::__io_sender<__io_uring::__renameat_operation> {
+    return {
+      {__sched.__context_},
+      {__old_dirfd,
+       static_cast<std::string&&>(__old_path),
+       __new_dirfd,
+       static_cast<std::string&&>(__new_path),
+       __flags}
+    };
+  }
+
+  /// @brief Removes a file, or a directory if flags contains AT_REMOVEDIR, like unlinkat(2).
+  inline auto io_uring_unlink(
+    io_uring_scheduler __sched,
+    std::string __path,
+    int __flags = 0,
+    int __dirfd = AT_FDCWD) -> __io_uring::__io_sender<__io_uring::__unlinkat_operation> {
+    return {{__sched.__context_}, {__dirfd, static_cast<std::string&&>(__path), __flags}};
+  }
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_SPLICE
+  /// @brief Moves up to length bytes from fd_in to fd_out like splice(2).
+  ///
+  /// One of the file descriptors must refer to a pipe. An offset of -1 reads from or writes to
+  /// the current file position; it must be -1 for a pipe. Completes with the number of bytes
+  /// moved, which is zero at the end of the input.
+  inline auto io_uring_splice(
+    io_uring_scheduler __sched,
+    int __fd_in,
+    ::off_t __offset_in,
+    int __fd_out,
+    ::off_t __offset_out,
+    std::size_t __length,
+    unsigned __flags = 0) noexcept -> __io_uring::__io_sender<__io_uring::__splice_operation> {
+    return {
+      {__sched.__context_}, {__fd_in, __offset_in, __fd_out, __offset_out, __length, __flags}};
+  }
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_TEE
+  /// @brief Duplicates up to length bytes from the pipe fd_in to the pipe fd_out like tee(2).
+  ///
+  /// Completes with the number of bytes duplicated.
+  inline auto io_uring_tee(
+    io_uring_scheduler __sched,
+    int __fd_in,
+    int __fd_out,
+    std::size_t __length,
+    unsigned __flags = 0) noexcept -> __io_uring::__io_sender<__io_uring::__tee_operation> {
+    return {{__sched.__context_}, {__fd_in, __fd_out, __length, __flags}};
+  }
+#endif
+
+#ifdef STDEXEC_HAS_IORING_OP_SEND_ZC
+  /// @brief Sends the buffer on the socket without copying it into the kernel.
+  ///
+  /// Completes with the number of bytes sent, but only after the kernel has notified that it
+  /// no longer references the buffer. The buffer may be reused as soon as the sender completes.
+  inline auto io_uring_send_zc(
+    io_uring_scheduler __sched,
+    int __fd,
+    std::span<const std::byte> __buffer,
+    int __flags = 0) noexcept -> __io_uring::__io_sender<__io_uring::__send_zc_operation> {
+    return {{__sched.__context_}, {__fd, __buffer, __flags}};
+  }
+#endif
+
+#ifdef STDEXEC_HAS_IO_URING_ASYNC_CANCELLATION
+  /// @brief A deadline for the stage that precedes it in an io_uring_link chain.
+  inline auto io_uring_link_timeout(std::chrono::nanoseconds __duration) noexcept
+    -> __io_uring::__link_timeout {
+    return __io_uring::__link_timeout{__duration};
+  }
+
+  /// @brief Submits the given io senders as one chain of linked operations.
+  ///
+  /// The kernel starts each stage after the previous stage has completed successfully, without
+  /// a round trip through this process. The sender completes with the values of all stages or
+  /// with the error of the first stage that failed. Stages that follow a failed stage are
+  /// canceled. A stage that reads or writes fewer bytes than requested fails the chain with an
+  /// io_uring_short_transfer error that tells which stage was short.
+  ///
+  /// An io_uring_link_timeout() stage puts a deadline on the stage that precedes it. If the
+  /// deadline expires, the sender completes with std::errc::timed_out. Each link timeout has to
+  /// follow an io sender.
+  ///
+  /// The stages are moved into the chain if they are rvalues, so move-only stages like
+  /// io_uring_close() can be linked, too. All io senders have to be created from schedulers of
+  /// the same io_uring_context.
+  template <class _First, class... _Stages>
+    requires __io_uring::__valid_link_chain<
+      stdexec::__decay_t<_First>,
+      stdexec::__decay_t<_Stages>...>
+  auto io_uring_link(_First&& __first, _Stages&&... __stages)
+    -> __io_uring::__link_sender<
+      false,
+      __io_uring::__stage_operation_t<stdexec::__decay_t<_First>>,
+      __io_uring::__stage_operation_t<stdexec::__decay_t<_Stages>>...> {
+    auto __env = __first.__env_;
+    return {
+      __env,
+      {__io_uring::__get_stage_operation(static_cast<_First&&>(__first)),
+       __io_uring::__get_stage_operation(static_cast<_Stages&&>(__stages))...}};
+  }
+#endif
+} // namespace exec
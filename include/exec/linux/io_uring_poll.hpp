@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "./io_uring_operations.hpp"
+#include "../sequence_senders.hpp"
+
+#ifdef STDEXEC_HAS_IORING_POLL_ADD_MULTI
+
+#  include <atomic>
+#  include <exception>
+#  include <optional>
+
+namespace exec {
+  namespace __io_uring {
+    using __poll_item_t = decltype(stdexec::just(0u));
+
+    // Receives the readiness events of a multishot poll.
+    struct __poll_sink {
+      void (*__on_event_)(__poll_sink*, unsigned) noexcept;
+    };
+
+    // Posts a completion with IORING_CQE_F_MORE each time the file descriptor becomes ready.
+    // The kernel may end the multishot poll with a final readiness event, for example if the
+    // completion queue overflows.
+    struct __multishot_poll_operation {
+      using __result_t = std::tuple<unsigned>;
+
+      int __fd_;
+      unsigned __events_;
+      __poll_sink* __sink_;
+
+      void prepare(::io_uring_sqe& __sqe) noexcept {
+        ::io_uring_sqe __sqe_{};
+        __sqe_.opcode = IORING_OP_POLL_ADD;
+        __sqe_.fd = __fd_;
+        __sqe_.len = IORING_POLL_ADD_MULTI;
+        __io_uring::__set_poll_events(__sqe_, __events_);
+        __sqe = __sqe_;
+      }
+
+      void more(const ::io_uring_cqe& __cqe) noexcept {
+        __sink_->__on_event_(__sink_, static_cast<unsigned>(__cqe.res));
+      }
+
+      static auto status(const ::io_uring_cqe& __cqe) noexcept -> int {
+        return __cqe.res;
+      }
+
+      static auto result(const ::io_uring_cqe& __cqe) noexcept -> __result_t {
+        return __result_t{static_cast<unsigned>(__cqe.res)};
+      }
+    };
+
+    template <class _ReceiverId>
+    struct __poll_sequence_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t;
+
+      using __env_t = stdexec::__env::__join_t<
+        stdexec::prop<stdexec::get_stop_token_t, stdexec::inplace_stop_token>,
+        stdexec::env_of_t<_Receiver>>;
+
+      struct __poll_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __t* __op_;
+
+        void set_value(unsigned __revents) noexcept {
+          __op_->__poll_ended(__revents);
+        }
+
+        void set_error(std::exception_ptr __error) noexcept {
+          __op_->__set_error(static_cast<std::exception_ptr&&>(__error));
+          __op_->__release();
+        }
+
+        void set_stopped() noexcept {
+          __op_->__poll_stopped();
+        }
+
+        auto get_env() const noexcept -> __env_t {
+          return __op_->__env();
+        }
+      };
+
+      struct __next_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __t* __op_;
+
+        void set_value() noexcept {
+          __op_->__item_done();
+        }
+
+        void set_stopped() noexcept {
+          __op_->__item_stopped();
+        }
+
+        auto get_env() const noexcept -> stdexec::env_of_t<_Receiver> {
+          return stdexec::get_env(__op_->__rcvr_);
+        }
+      };
+
+      using __poll_sender_t = __io_sender<__multishot_poll_operation>;
+      using __poll_operation_t = stdexec::connect_result_t<__poll_sender_t, __poll_receiver>;
+      using __next_operation_t =
+        stdexec::connect_result_t<next_sender_of_t<_Receiver, __poll_item_t>, __next_receiver>;
+
+      struct __on_stop_requested {
+        stdexec::inplace_stop_source& __stop_source_;
+
+        void operator()() noexcept {
+          __stop_source_.request_stop();
+        }
+      };
+
+      using __on_stop_t = stdexec::stop_callback_for_t<
+        stdexec::stop_token_of_t<stdexec::env_of_t<_Receiver>&>,
+        __on_stop_requested>;
+
+      class __t : __poll_sink {
+        friend struct __poll_receiver;
+        friend struct __next_receiver;
+
+        __context& __context_;
+        int __fd_;
+        unsigned __events_;
+        _Receiver __rcvr_;
+        // Stops the poll if either the receiver or an item asks for it.
+        stdexec::inplace_stop_source __stop_source_{};
+        std::optional<__on_stop_t> __on_stop_{};
+        std::optional<__poll_operation_t> __poll_op_{};
+        std::optional<__next_operation_t> __next_op_{};
+        // The events that have not been handed out yet.
+        std::atomic<unsigned> __pending_{0};
+        // Whether an item is in flight. At most one item is in flight at a time, events that
+        // arrive in the meantime are merged into the next item.
+        std::atomic<bool> __busy_{false};
+        // One reference for the poll and one for an item in flight.
+        std::atomic<int> __n_active_{0};
+        std::atomic<bool> __has_error_{false};
+        std::exception_ptr __error_{};
+        // Whether the poll was stopped without the sequence asking for it, e.g. by the context.
+        std::atomic<bool> __poll_was_stopped_{false};
+
+        auto __env() const noexcept -> __env_t {
+          auto __token = stdexec::prop{stdexec::get_stop_token, __stop_source_.get_token()};
+          return stdexec::__env::__join(std::move(__token), stdexec::get_env(__rcvr_));
+        }
+
+        void __arm() noexcept {
+          stdexec::start(__poll_op_.emplace(stdexec::__emplace_from{[&] {
+            return stdexec::connect(
+              __poll_sender_t{{&__context_}, {__fd_, __events_, this}}, __poll_receiver{this});
+          }}));
+        }
+
+        void __set_error(std::exception_ptr __error) noexcept {
+          if (!__has_error_.exchange(true, std::memory_order_relaxed)) {
+            __error_ = static_cast<std::exception_ptr&&>(__error);
+          }
+          __stop_source_.request_stop();
+        }
+
+        static void __on_event_of(__poll_sink* __sink, unsigned __revents) noexcept {
+          static_cast<__t*>(__sink)->__on_event(__revents);
+        }
+
+        void __on_event(unsigned __revents) noexcept {
+          __pending_.fetch_or(__revents, std::memory_order_relaxed);
+          __try_emit();
+        }
+
+        // The kernel has ended the multishot poll. Rearm it unless the sequence is done.
+        void __poll_ended(unsigned __revents) noexcept {
+          __on_event(__revents);
+          if (__stop_source_.stop_requested()) {
+            __release();
+          } else {
+            __arm();
+          }
+        }
+
+        // No item may be emitted once the poll is gone.
+        void __poll_stopped() noexcept {
+          if (!__stop_source_.stop_requested()) {
+            __poll_was_stopped_.store(true, std::memory_order_relaxed);
+            __stop_source_.request_stop();
+          }
+          __release();
+        }
+
+        void __try_emit() noexcept {
+          while (!__busy_.exchange(true, std::memory_order_acq_rel)) {
+            const unsigned __revents = __pending_.exchange(0, std::memory_order_acq_rel);
+            if (__revents != 0 && !__stop_source_.stop_requested()) {
+              __n_active_.fetch_add(1, std::memory_order_relaxed);
+              __emit(__revents);
+              return;
+            }
+            __busy_.store(false, std::memory_order_release);
+            // Retry if an event arrived after we have looked for one.
+            if (__pending_.load(std::memory_order_acquire) == 0) {
+              return;
+            }
+          }
+        }
+
+        void __emit(unsigned __revents) noexcept {
+          try {
+            stdexec::start(__next_op_.emplace(stdexec::__emplace_from{[&] {
+              return stdexec::connect(
+                exec::set_next(__rcvr_, stdexec::just(__revents)), __next_receiver{this});
+            }}));
+          } catch (...) {
+            __set_error(std::current_exception());
+            __busy_.store(false, std::memory_order_release);
+            __release();
+          }
+        }
+
+        void __item_done() noexcept {
+          __busy_.store(false, std::memory_order_release);
+          __try_emit();
+          __release();
+        }
+
+        void __item_stopped() noexcept {
+          __stop_source_.request_stop();
+          __busy_.store(false, std::memory_order_release);
+          __release();
+        }
+
+        // Completes the sequence once the poll has ended and no item is in flight. This
+        // operation must not be accessed after calling this function.
+        void __release() noexcept {
+          if (__n_active_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          __on_stop_.reset();
+          if (__has_error_.load(std::memory_order_relaxed)) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::move(__error_));
+          } else if (__poll_was_stopped_.load(std::memory_order_relaxed)) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          } else {
+            __set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+          }
+        }
+
+       public:
+        __t(__context& __context, int __fd, unsigned __events, _Receiver&& __rcvr)
+          : __poll_sink{&__on_event_of}
+          , __context_{__context}
+          , __fd_{__fd}
+          , __events_{__events}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        void start() & noexcept {
+          __n_active_.store(1, std::memory_order_relaxed);
+          __on_stop_.emplace(
+            stdexec::get_stop_token(stdexec::get_env(__rcvr_)),
+            __on_stop_requested{__stop_source_});
+          __arm();
+        }
+      };
+    };
+
+    struct __poll_sequence_sender {
+      using __id = __poll_sequence_sender;
+      using __t = __poll_sequence_sender;
+      using sender_concept = sequence_sender_t;
+      using completion_signatures = stdexec::completion_signatures<
+        stdexec::set_value_t(),
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()>;
+      using item_types = exec::item_types<__poll_item_t>;
+
+      __context* __context_;
+      int __fd_;
+      unsigned __events_;
+
+      template <
+        stdexec::__decays_to<__poll_sequence_sender> _Self,
+        sequence_receiver_of<item_types> _Receiver>
+      STDEXEC_MEMFN_DECL(auto subscribe)(this _Self&& __self, _Receiver __rcvr)
+        -> stdexec::__t<__poll_sequence_operation<stdexec::__id<_Receiver>>> {
+        return {
+          *__self.__context_, __self.__fd_, __self.__events_, static_cast<_Receiver&&>(__rcvr)};
+      }
+    };
+  } // namespace __io_uring
+
+  /// @brief Returns a sequence sender that yields the ready poll(2) events of the file
+  /// descriptor each time it becomes ready for one of the given events.
+  ///
+  /// A single multishot IORING_OP_POLL_ADD stays armed for the lifetime of the sequence. At
+  /// most one item is in flight at a time; events that arrive while the receiver is busy are
+  /// merged into the next item. The sequence runs until it is stopped, either by the receiver
+  /// or by an item that completes with set_stopped(), which cancels the poll. If the context
+  /// stops the poll, the sequence completes with set_stopped().
+  inline auto
+    io_uring_poll_multishot(io_uring_scheduler __sched, int __fd, unsigned __events) noexcept
+    -> __io_uring::__poll_sequence_sender {
+    return {__sched.__context_, __fd, __events};
+  }
+} // namespace exec
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "./io_uring_operations.hpp"
+#include "../sequence_senders.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <span>
+#include <system_error>
+
+#include <sys/stat.h>
+
+namespace exec {
+  namespace __io_uring {
+    using __read_stream_item_t = decltype(stdexec::just(std::span<const std::byte>{}));
+
+    template <class _ReceiverId>
+    struct __read_stream_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t;
+      struct __slot;
+
+      struct __next_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __slot* __slot_;
+
+        void set_value() noexcept {
+          __slot_->__parent_->__item_done(*__slot_);
+        }
+
+        void set_stopped() noexcept {
+          __slot_->__parent_->__item_stopped(*__slot_);
+        }
+
+        auto get_env() const noexcept -> stdexec::env_of_t<_Receiver> {
+          return stdexec::get_env(__slot_->__parent_->__rcvr_);
+        }
+      };
+
+      using __next_operation_t = stdexec::
+        connect_result_t<next_sender_of_t<_Receiver, __read_stream_item_t>, __next_receiver>;
+
+      // Each slot owns one buffer of the pool. A slot alternates between reading the next chunk
+      // of the file into its buffer and lending the buffer to the receiver until the receiver
+      // is done with the item.
+      struct __slot : __task {
+        __t* __parent_{nullptr};
+        std::byte* __buffer_{nullptr};
+        ::off_t __offset_{0};
+        std::size_t __length_{0};
+        std::size_t __filled_{0};
+        __read_operation __read_{};
+        // Set by the thread that drives the context. Taken by that thread to hand out the buffer
+        // or by any thread to retire the slot once the context has been closed.
+        std::atomic<bool> __ready_{false};
+        std::optional<__next_operation_t> __next_op_{};
+
+        static auto __is_ready(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto& __self = *static_cast<__slot*>(__pointer);
+          __self.__read_.__fd_ = __self.__parent_->__fd_;
+          __self.__read_.__buffer_ = {
+            __self.__buffer_ + __self.__filled_, __self.__length_ - __self.__filled_};
+          __self.__read_.__offset_ = __self.__offset_ + static_cast<::off_t>(__self.__filled_);
+          __self.__read_.prepare(__sqe);
+        }
+
+        static void __complete(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          auto& __self = *static_cast<__slot*>(__pointer);
+          __self.__parent_->__read_done(__self, __cqe.res);
+        }
+
+        static constexpr __task_vtable __vtable{&__is_ready, &__submit, &__complete};
+
+        __slot() noexcept
+          : __task{__vtable} {
+        }
+      };
+
+      class __t {
+        friend struct __next_receiver;
+        friend struct __slot;
+
+        __context& __context_;
+        int __fd_;
+        std::size_t __buffer_size_;
+        std::size_t __n_slots_;
+        _Receiver __rcvr_;
+        std::unique_ptr<std::byte[]> __buffers_;
+        std::unique_ptr<__slot[]> __slots_;
+        ::off_t __file_size_{0};
+        std::atomic<::off_t> __next_offset_{0};
+        // Only accessed by the thread that drives the context.
+        ::off_t __next_emit_offset_{0};
+        std::atomic<std::size_t> __n_active_{0};
+        std::atomic<bool> __done_{false};
+        // Whether the context stopped a read, which stops the whole stream.
+        std::atomic<bool> __stopped_{false};
+        std::atomic<bool> __has_error_{false};
+        std::exception_ptr __error_{};
+
+        auto __stop_requested() const noexcept -> bool {
+          return __done_.load(std::memory_order_relaxed)
+              || stdexec::get_stop_token(stdexec::get_env(__rcvr_)).stop_requested();
+        }
+
+        void __set_error(std::exception_ptr __error) noexcept {
+          if (!__has_error_.exchange(true, std::memory_order_relaxed)) {
+            __error_ = static_cast<std::exception_ptr&&>(__error);
+          }
+          __done_.store(true, std::memory_order_relaxed);
+        }
+
+        // Reads the next chunk of the file into the buffer of the given slot. Retires the slot
+        // once the whole file has been handed out.
+        void __issue(__slot& __slot) noexcept {
+          if (__stop_requested()) {
+            __retire();
+            return;
+          }
+          const ::off_t __offset = __next_offset_.fetch_add(
+            static_cast<::off_t>(__buffer_size_), std::memory_order_relaxed);
+          if (__offset >= __file_size_) {
+            __retire();
+            return;
+          }
+          __slot.__offset_ = __offset;
+          __slot.__length_ =
+            std::min(__buffer_size_, static_cast<std::size_t>(__file_size_ - __offset));
+          __slot.__filled_ = 0;
+          if (__context_.submit(&__slot)) {
+            __context_.__wakeup_after_submit();
+          }
+        }
+
+        void __read_done(__slot& __slot, int __res) noexcept {
+          if (__res > 0) {
+            __slot.__filled_ += static_cast<std::size_t>(__res);
+          }
+          if (__res > 0 && __slot.__filled_ < __slot.__length_) {
+            if (__context_.submit(&__slot)) {
+              __context_.__wakeup_after_submit();
+            }
+          } else if (__res > 0) {
+            __slot.__ready_.store(true, std::memory_order_relaxed);
+            __emit_ready();
+          } else {
+            if (__res == -ECANCELED) {
+              __stopped_.store(true, std::memory_order_relaxed);
+              __done_.store(true, std::memory_order_relaxed);
+            } else {
+              // A read of zero bytes means that the file has been truncated while reading it.
+              __set_error(std::make_exception_ptr(
+                std::system_error(__res < 0 ? -__res : EIO, std::system_category())));
+            }
+            if (__context_.__is_driven_by_this_thread()) {
+              __emit_ready();
+              __retire();
+            } else {
+              // A context that has been closed already stops the read inline in submit(), on
+              // the thread of the item that issued it. Nothing is emitted anymore, so the
+              // buffers that are ready can be retired without the thread of the context.
+              __retire(1 + __retire_ready());
+            }
+          }
+        }
+
+        // Takes all slots that are ready and returns their number.
+        auto __retire_ready() noexcept -> std::size_t {
+          std::size_t __n_retired = 0;
+          for (std::size_t __i = 0; __i < __n_slots_; ++__i) {
+            if (__slots_[__i].__ready_.exchange(false, std::memory_order_relaxed)) {
+              ++__n_retired;
+            }
+          }
+          return __n_retired;
+        }
+
+        // Hands out all buffers that are ready in the order of their offsets and retires them
+        // instead if the stream is done. This is only called by the thread that drives the
+        // context.
+        void __emit_ready() noexcept {
+          // Items may complete inline and retire their slots. Keep this operation alive until
+          // we are done with the slots.
+          __n_active_.fetch_add(1, std::memory_order_relaxed);
+          std::size_t __n_retired = 1;
+          bool __found = true;
+          while (__found) {
+            __found = false;
+            for (std::size_t __i = 0; __i < __n_slots_; ++__i) {
+              __slot& __slot = __slots_[__i];
+              if (!__slot.__ready_.load(std::memory_order_relaxed)) {
+                continue;
+              }
+              if (__stop_requested()) {
+                __n_retired += __slot.__ready_.exchange(false, std::memory_order_relaxed) ? 1 : 0;
+              } else if (
+                __slot.__offset_ == __next_emit_offset_
+                && __slot.__ready_.exchange(false, std::memory_order_relaxed)) {
+                __next_emit_offset_ += static_cast<::off_t>(__slot.__length_);
+                __found = true;
+                __n_retired += __emit(__slot) ? 0 : 1;
+              }
+            }
+          }
+          __retire(__n_retired);
+        }
+
+        // Returns false if the item could not be started.
+        auto __emit(__slot& __slot) noexcept -> bool {
+          try {
+            std::span<const std::byte> __chunk{__slot.__buffer_, __slot.__length_};
+            stdexec::start(__slot.__next_op_.emplace(stdexec::__emplace_from{[&] {
+              return stdexec::connect(
+                exec::set_next(__rcvr_, stdexec::just(__chunk)), __next_receiver{&__slot});
+            }}));
+            return true;
+          } catch (...) {
+            __set_error(std::current_exception());
+            return false;
+          }
+        }
+
+        void __item_done(__slot& __slot) noexcept {
+          __issue(__slot);
+        }
+
+        void __item_stopped(__slot&) noexcept {
+          __done_.store(true, std::memory_order_relaxed);
+          __retire();
+        }
+
+        // Completes the stream once all slots have been retired. This operation must not be
+        // accessed after calling this function.
+        void __retire(std::size_t __n = 1) noexcept {
+          if (__n_active_.fetch_sub(__n, std::memory_order_acq_rel) == __n) {
+            if (__has_error_.load(std::memory_order_relaxed)) {
+              stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::move(__error_));
+            } else if (__stopped_.load(std::memory_order_relaxed)) {
+              // The file has not been read to its end.
+              stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+            } else {
+              __set_value_unless_stopped(static_cast<_Receiver&&>(__rcvr_));
+            }
+          }
+        }
+
+       public:
+        __t(
+          __context& __context,
+          int __fd,
+          std::size_t __buffer_size,
+          std::size_t __n_buffers,
+          _Receiver&& __rcvr)
+          : __context_{__context}
+          , __fd_{__fd}
+          , __buffer_size_{std::max<std::size_t>(__buffer_size, 1)}
+          , __n_slots_{std::max<std::size_t>(__n_buffers, 1)}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)}
+          , __buffers_{new std::byte[__buffer_size_ * __n_slots_]}
+          , __slots_{new __slot[__n_slots_]} {
+          for (std::size_t __i = 0; __i < __n_slots_; ++__i) {
+            __slots_[__i].__parent_ = this;
+            __slots_[__i].__buffer_ = __buffers_.get() + __i * __buffer_size_;
+          }
+        }
+
+        void start() & noexcept {
+          struct ::stat __stat {};
+          if (::fstat(__fd_, &__stat) < 0) {
+            stdexec::set_error(
+              static_cast<_Receiver&&>(__rcvr_),
+              std::make_exception_ptr(std::system_error(errno, std::system_category())));
+            return;
+          }
+          __file_size_ = __stat.st_size;
+          __n_active_.store(__n_slots_, std::memory_order_relaxed);
+          for (std::size_t __i = 0; __i < __n_slots_; ++__i) {
+            __issue(__slots_[__i]);
+          }
+        }
+      };
+    };
+
+    struct __read_stream_sender {
+      using __id = __read_stream_sender;
+      using __t = __read_stream_sender;
+      using sender_concept = sequence_sender_t;
+      using completion_signatures = stdexec::completion_signatures<
+        stdexec::set_value_t(),
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()>;
+      using item_types = exec::item_types<__read_stream_item_t>;
+
+      __context* __context_;
+      int __fd_;
+      std::size_t __buffer_size_;
+      std::size_t __n_buffers_;
+
+      template <
+        stdexec::__decays_to<__read_stream_sender> _Self,
+        sequence_receiver_of<item_types> _Receiver>
+      STDEXEC_MEMFN_DECL(auto subscribe)(this _Self&& __self, _Receiver __rcvr)
+        -> stdexec::__t<__read_stream_operation<stdexec::__id<_Receiver>>> {
+        return {
+          *__self.__context_,
+          __self.__fd_,
+          __self.__buffer_size_,
+          __self.__n_buffers_,
+          static_cast<_Receiver&&>(__rcvr)};
+      }
+    };
+  } // namespace __io_uring
+
+  /// @brief Returns a sequence sender that reads the regular file fd from front to back and
+  /// yields its contents in chunks of buffer_size bytes as std::span<const std::byte>.
+  ///
+  /// Up to n_buffers reads are in flight at the same time. A buffer is only reused after the
+  /// receiver is done with the item that refers to it, which limits the memory usage and
+  /// applies back-pressure to the reads if the receiver is slow. Items are yielded in file
+  /// order from the thread that drives the context.
+  inline auto io_uring_read_stream(
+    io_uring_scheduler __sched,
+    int __fd,
+    std::size_t __buffer_size,
+    std::size_t __n_buffers = 2) noexcept -> __io_uring::__read_stream_sender {
+    return {__sched.__context_, __fd, __buffer_size, __n_buffers};
+  }
+} // namespace exec
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "./io_uring_context.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace exec {
+  namespace __io_uring {
+    // Returns the cpus on which this process is allowed to run. The cpu variables must not be
+    // called __cpu, which is the name of a local variable inside the CPU_* macros of glibc.
+    inline auto __allowed_cpus() -> std::vector<int> {
+      std::vector<int> __cpus{};
+      ::cpu_set_t __set;
+      CPU_ZERO(&__set);
+      if (::sched_getaffinity(0, sizeof(__set), &__set) == 0) {
+        for (int __cpu_index = 0; __cpu_index < CPU_SETSIZE; ++__cpu_index) {
+          if (CPU_ISSET(__cpu_index, &__set)) {
+            __cpus.push_back(__cpu_index);
+          }
+        }
+      }
+      return __cpus;
+    }
+
+    // Pins the calling thread to the given cpu. Pinning is best effort, failures are ignored.
+    inline void __pin_this_thread_to(int __cpu_index) noexcept {
+      ::cpu_set_t __set;
+      CPU_ZERO(&__set);
+      CPU_SET(__cpu_index, &__set);
+      ::pthread_setaffinity_np(::pthread_self(), sizeof(__set), &__set);
+    }
+
+    /// @brief A thread-per-core runtime that drives one io_uring context per thread.
+    ///
+    /// Each thread is pinned to one of the cpus on which this process is allowed to run.
+    /// Tasks that are handed from one ring to another wake up the receiving thread by messaging
+    /// its ring with IORING_OP_MSG_RING instead of writing to its eventfd, if the kernel supports
+    /// it.
+    class __runtime {
+     public:
+      /// @brief Creates a runtime with one ring per cpu on which this process is allowed to run.
+      explicit __runtime(const __context_options& __options = {})
+        : __runtime(0, __options) {
+      }
+
+      /// @brief Creates a runtime with the given number of rings.
+      ///
+      /// If __n_rings is zero, one ring per allowed cpu is created.
+      explicit __runtime(std::size_t __n_rings, const __context_options& __options = {}) {
+        std::vector<int> __cpus = __allowed_cpus();
+        if (__n_rings == 0) {
+          __n_rings = std::max<std::size_t>(__cpus.size(), 1);
+        }
+        __contexts_.reserve(__n_rings);
+        __peers_.reserve(__n_rings);
+        for (std::size_t __i = 0; __i < __n_rings; ++__i) {
+          auto& __ctx = __contexts_.emplace_back(std::make_unique<__context>(__options));
+          __peers_.push_back(__ctx.get());
+        }
+        for (__context* __ctx: __peers_) {
+          __ctx->__set_peers(__peers_);
+        }
+        __threads_.reserve(__n_rings);
+        try {
+          for (std::size_t __i = 0; __i < __n_rings; ++__i) {
+            int __cpu = __cpus.empty() ? -1 : __cpus[__i % __cpus.size()];
+            __threads_.emplace_back([__ctx = __peers_[__i], __cpu] {
+              if (__cpu >= 0) {
+                __pin_this_thread_to(__cpu);
+              }
+              __ctx->run_until_stopped();
+            });
+          }
+        } catch (...) {
+          __stop_and_join();
+          throw;
+        }
+      }
+
+      __runtime(__runtime&&) = delete;
+
+      ~__runtime() {
+        __stop_and_join();
+      }
+
+      /// @brief Returns the number of rings in this runtime.
+      [[nodiscard]]
+      auto size() const noexcept -> std::size_t {
+        return __peers_.size();
+      }
+
+      /// @brief Returns a scheduler that targets the ring with the given index.
+      [[nodiscard]]
+      auto get_scheduler(std::size_t __index) noexcept -> __scheduler {
+        STDEXEC_ASSERT(__index < __peers_.size());
+        return __peers_[__index]->get_scheduler();
+      }
+
+      /// @brief Returns a scheduler that targets the least loaded ring.
+      ///
+      /// The load of a ring is the number of its operations that are in flight in the kernel.
+      /// Ties are broken in a round-robin fashion.
+      [[nodiscard]]
+      auto get_scheduler() noexcept -> __scheduler {
+        const std::size_t __n = __peers_.size();
+        const std::size_t __start = __next_.fetch_add(1, std::memory_order_relaxed) % __n;
+        __context* __best = __peers_[__start];
+        std::ptrdiff_t __best_load = __best->__load();
+        for (std::size_t __i = 1; __i < __n && __best_load > 0; ++__i) {
+          __context* __ctx = __peers_[(__start + __i) % __n];
+          std::ptrdiff_t __load = __ctx->__load();
+          if (__load < __best_load) {
+            __best = __ctx;
+            __best_load = __load;
+          }
+        }
+        return __best->get_scheduler();
+      }
+
+      /// @brief Returns the context of the ring with the given index.
+      [[nodiscard]]
+      auto context(std::size_t __index) noexcept -> __context& {
+        STDEXEC_ASSERT(__index < __peers_.size());
+        return *__peers_[__index];
+      }
+
+     private:
+      void __stop_and_join() noexcept {
+        for (__context* __ctx: __peers_) {
+          __ctx->request_stop();
+        }
+        for (std::thread& __thr: __threads_) {
+          if (__thr.joinable()) {
+            __thr.join();
+          }
+        }
+        __threads_.clear();
+      }
+
+      std::vector<std::unique_ptr<__context>> __contexts_{};
+      std::vector<__context*> __peers_{};
+      std::vector<std::thread> __threads_{};
+      std::atomic<std::size_t> __next_{0};
+    };
+  } // namespace __io_uring
+
+  using io_uring_runtime = __io_uring::__runtime;
+} // namespace exec
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "./io_uring_operations.hpp"
+#include "./safe_file_descriptor.hpp"
+
+#ifdef STDEXEC_HAS_IORING_OP_SPLICE
+
+#  include <algorithm>
+#  include <atomic>
+#  include <cerrno>
+#  include <cstddef>
+#  include <cstring>
+#  include <exception>
+#  include <optional>
+#  include <system_error>
+
+#  include <fcntl.h>
+#  include <unistd.h>
+
+namespace exec {
+  namespace __io_uring {
+    template <class _ReceiverId>
+    struct __transfer_file_operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      // The transfer alternates between splicing a chunk of the file into a pipe and splicing
+      // the contents of the pipe into the socket. Only one splice is in flight at a time.
+      class __t : public __task {
+        enum class __stage {
+          __fill,
+          __drain,
+          __stopped
+        };
+
+        // Cancels the splice that is in flight when a stop is requested.
+        struct __cancel_task : __task {
+          __t* __parent_;
+
+          static auto __ready_(__task*) noexcept -> bool {
+            return false;
+          }
+
+          static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+            auto& __self = *static_cast<__cancel_task*>(__pointer);
+            std::memset(&__sqe, 0, sizeof(__sqe));
+            __sqe.opcode = IORING_OP_ASYNC_CANCEL;
+            __sqe.addr = bit_cast<__u64>(static_cast<__task*>(__self.__parent_));
+          }
+
+          static void __complete_(__task* __pointer, const ::io_uring_cqe&) noexcept {
+            static_cast<__cancel_task*>(__pointer)->__parent_->__release();
+          }
+
+          static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+          explicit __cancel_task(__t* __parent) noexcept
+            : __task{__vtable}
+            , __parent_{__parent} {
+          }
+        };
+
+        struct __stop_callback {
+          __t* __self_;
+
+          void operator()() noexcept {
+            __self_->__request_stop();
+          }
+        };
+
+        using __on_context_stop_t = std::optional<stdexec::inplace_stop_callback<__stop_callback>>;
+        using __on_receiver_stop_t = std::optional<typename stdexec::stop_token_of_t<
+          stdexec::env_of_t<_Receiver>&>::template callback_type<__stop_callback>>;
+
+        __context& __context_;
+        int __fd_in_;
+        int __socket_;
+        ::off_t __offset_;
+        std::size_t __remaining_;
+        std::size_t __chunk_size_;
+        _Receiver __rcvr_;
+        safe_file_descriptor __pipe_out_{};
+        safe_file_descriptor __pipe_in_{};
+        std::size_t __in_pipe_{0};
+        std::size_t __transferred_{0};
+        __stage __stage_{__stage::__fill};
+        int __error_{0};
+        // One reference for the transfer and one for a pending cancellation.
+        std::atomic<int> __n_ops_{0};
+        std::atomic<bool> __stop_requested_{false};
+        __cancel_task __cancel_{this};
+        __on_context_stop_t __on_context_stop_{};
+        __on_receiver_stop_t __on_receiver_stop_{};
+
+        void __request_stop() noexcept {
+          __stop_requested_.store(true, std::memory_order_relaxed);
+          int __expected = 1;
+          if (__n_ops_.compare_exchange_strong(__expected, 2, std::memory_order_relaxed)) {
+            if (__context_.submit(&__cancel_)) {
+              __context_.__wakeup_after_submit();
+            }
+          }
+        }
+
+        // Both the splices and the cancellation are prepared on the thread that drives the
+        // context. A splice that is prepared after the stop request has been observed is
+        // replaced by a no-op, so the cancellation cannot miss it.
+        static auto __ready_(__task*) noexcept -> bool {
+          return false;
+        }
+
+        static void __submit_(__task* __pointer, ::io_uring_sqe& __sqe) noexcept {
+          auto& __self = *static_cast<__t*>(__pointer);
+          if (__self.__stop_requested_.load(std::memory_order_relaxed)) {
+            __self.__stage_ = __stage::__stopped;
+            std::memset(&__sqe, 0, sizeof(__sqe));
+            __sqe.opcode = IORING_OP_NOP;
+          } else if (__self.__in_pipe_ == 0) {
+            __self.__stage_ = __stage::__fill;
+            __splice_operation{
+              __self.__fd_in_,
+              __self.__offset_,
+              __self.__pipe_in_.native_handle(),
+              -1,
+              std::min(__self.__remaining_, __self.__chunk_size_),
+              SPLICE_F_MOVE}
+              .prepare(__sqe);
+          } else {
+            __self.__stage_ = __stage::__drain;
+            const bool __more = __self.__remaining_ > 0;
+            __splice_operation{
+              __self.__pipe_out_.native_handle(),
+              -1,
+              __self.__socket_,
+              -1,
+              __self.__in_pipe_,
+              SPLICE_F_MOVE | (__more ? SPLICE_F_MORE : 0u)}
+              .prepare(__sqe);
+          }
+        }
+
+        static void __complete_(__task* __pointer, const ::io_uring_cqe& __cqe) noexcept {
+          static_cast<__t*>(__pointer)->__step(__cqe.res);
+        }
+
+        static constexpr __task_vtable __vtable{&__ready_, &__submit_, &__complete_};
+
+        void __step(int __res) noexcept {
+          // A canceled splice may also fail with EINTR, so the stop request takes precedence.
+          if (__res == -ECANCELED || __stop_requested_.load(std::memory_order_relaxed)) {
+            __stage_ = __stage::__stopped;
+          }
+          if (__stage_ == __stage::__stopped) {
+            __release();
+            return;
+          }
+          if (__res < 0) {
+            __error_ = -__res;
+            __release();
+            return;
+          }
+          const auto __n = static_cast<std::size_t>(__res);
+          if (__stage_ == __stage::__fill) {
+            __in_pipe_ = __n;
+            __offset_ += static_cast<::off_t>(__n);
+            // The file ends before the requested range does.
+            __remaining_ = __n == 0 ? 0 : __remaining_ - __n;
+          } else if (__n == 0) {
+            __error_ = EPIPE;
+          } else {
+            __in_pipe_ -= __n;
+            __transferred_ += __n;
+          }
+          if (__error_ != 0 || (__in_pipe_ == 0 && __remaining_ == 0)) {
+            __release();
+          } else if (__context_.submit(this)) {
+            __context_.__wakeup_after_submit();
+          }
+        }
+
+        // Completes the receiver once both the transfer and a pending cancellation are done.
+        // This operation must not be accessed after calling this function.
+        void __release() noexcept {
+          if (__n_ops_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          __on_context_stop_.reset();
+          __on_receiver_stop_.reset();
+          if (__stage_ == __stage::__stopped) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+          } else if (__error_ != 0) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), __io_error(-__error_));
+          } else {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_), std::size_t{__transferred_});
+          }
+        }
+
+       public:
+        __t(
+          __context& __context,
+          int __fd_in,
+          int __socket,
+          ::off_t __offset,
+          std::size_t __length,
+          std::size_t __chunk_size,
+          _Receiver&& __rcvr)
+          : __task{__vtable}
+          , __context_{__context}
+          , __fd_in_{__fd_in}
+          , __socket_{__socket}
+          , __offset_{__offset}
+          , __remaining_{__length}
+          , __chunk_size_{std::max<std::size_t>(__chunk_size, 1)}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        __t(__t&&) = delete;
+
+        void start() & noexcept {
+          if (__remaining_ == 0) {
+            stdexec::set_value(static_cast<_Receiver&&>(__rcvr_), std::size_t{0});
+            return;
+          }
+          int __pipe[2];
+          if (::pipe2(__pipe, O_CLOEXEC) < 0) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), __io_error(-errno));
+            return;
+          }
+          __pipe_out_ = safe_file_descriptor{__pipe[0]};
+          __pipe_in_ = safe_file_descriptor{__pipe[1]};
+          // A pipe that holds a whole chunk halves the number of round trips. The default
+          // capacity of 64 KiB is kept if the pipe cannot be resized.
+          const std::size_t __pipe_size = std::min(__chunk_size_, std::size_t{1} << 20);
+          ::fcntl(__pipe_in_, F_SETPIPE_SZ, static_cast<int>(__pipe_size));
+          __n_ops_.store(1, std::memory_order_relaxed);
+          __on_context_stop_.emplace(__context_.get_stop_token(), __stop_callback{this});
+          __on_receiver_stop_.emplace(
+            stdexec::get_stop_token(stdexec::get_env(__rcvr_)), __stop_callback{this});
+          if (__context_.submit(this)) {
+            __context_.__wakeup_after_submit();
+          }
+        }
+      };
+    };
+
+    struct __transfer_file_sender {
+      using sender_concept = stdexec::sender_t;
+      using __id = __transfer_file_sender;
+      using __t = __transfer_file_sender;
+      using completion_signatures = stdexec::completion_signatures<
+        stdexec::set_value_t(std::size_t),
+        stdexec::set_error_t(std::exception_ptr),
+        stdexec::set_stopped_t()>;
+
+      __scheduler::__schedule_env __env_;
+      int __fd_in_;
+      int __socket_;
+      ::off_t __offset_;
+      std::size_t __length_;
+      std::size_t __chunk_size_;
+
+      auto get_env() const noexcept -> __scheduler::__schedule_env {
+        return __env_;
+      }
+
+      template <stdexec::receiver_of<completion_signatures> _Receiver>
+      auto connect(_Receiver __rcvr) const
+        -> stdexec::__t<__transfer_file_operation<stdexec::__id<_Receiver>>> {
+        return {
+          *__env_.__context_,
+          __fd_in_,
+          __socket_,
+          __offset_,
+          __length_,
+          __chunk_size_,
+          static_cast<_Receiver&&>(__rcvr)};
+      }
+    };
+  } // namespace __io_uring
+
+  /// @brief Sends length bytes of the file fd_in, starting at offset, on the socket without
+  /// copying them through user space.
+  ///
+  /// The data is moved through a pipe with IORING_OP_SPLICE in chunks of chunk_size bytes.
+  /// Completes with the number of bytes sent, which is less than length if the file ends
+  /// before. The file position of fd_in is not changed.
+  inline auto io_uring_transfer_file(
+    io_uring_scheduler __sched,
+    int __fd_in,
+    int __socket,
+    ::off_t __offset,
+    std::size_t __length,
+    std::size_t __chunk_size = std::size_t{1} << 16) noexcept
+    -> __io_uring::__transfer_file_sender {
+    return {{__sched.__context_}, __fd_in, __socket, __offset, __length, __chunk_size};
+  }
+} // namespace exec
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/__detail/__config.hpp"
+
+#include "./memory_mapped_region.hpp"
+#include "./safe_file_descriptor.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if STDEXEC_HAS_STD_RANGES()
+#  include "../sequence/iterate.hpp"
+
+#  include <ranges>
+#endif
+
+namespace exec {
+  /// Controls how map_file() maps a file and which access pattern it announces to the kernel.
+  struct map_file_options {
+    /// The file is read front to back (MADV_SEQUENTIAL). The kernel reads ahead aggressively
+    /// and drops pages behind the reader.
+    bool sequential = true;
+    /// Start reading the whole file into the page cache right away (MADV_WILLNEED).
+    bool will_need = true;
+    /// Back the mapping with transparent huge pages where the file system supports it
+    /// (MADV_HUGEPAGE). This reduces the number of TLB misses for large files.
+    bool huge_pages = true;
+    /// Pre-fault all pages of the mapping (MAP_POPULATE).
+    bool populate = false;
+  };
+
+  /// @brief Maps the file at the given path read-only into memory.
+  ///
+  /// Returns an empty region for an empty file and throws std::system_error if the file cannot
+  /// be opened or mapped. Advice that the kernel does not support is ignored.
+  inline auto map_file(const char* __path, const map_file_options& __options = {})
+    -> memory_mapped_region {
+    safe_file_descriptor __fd{::open(__path, O_RDONLY | O_CLOEXEC)};
+    if (!__fd) {
+      throw std::system_error(errno, std::system_category());
+    }
+    struct ::stat __stat {};
+    if (::fstat(__fd, &__stat) < 0) {
+      throw std::system_error(errno, std::system_category());
+    }
+    const auto __size = static_cast<std::size_t>(__stat.st_size);
+    if (__size == 0) {
+      return memory_mapped_region{};
+    }
+    const int __flags = MAP_SHARED | (__options.populate ? MAP_POPULATE : 0);
+    void* __ptr = ::mmap(nullptr, __size, PROT_READ, __flags, __fd, 0);
+    if (__ptr == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category());
+    }
+    memory_mapped_region __region{__ptr, __size};
+    if (__options.sequential) {
+      ::madvise(__ptr, __size, MADV_SEQUENTIAL);
+    }
+    if (__options.will_need) {
+      ::madvise(__ptr, __size, MADV_WILLNEED);
+    }
+#ifdef MADV_HUGEPAGE
+    if (__options.huge_pages) {
+      ::madvise(__ptr, __size, MADV_HUGEPAGE);
+    }
+#endif
+    return __region;
+  }
+
+#if STDEXEC_HAS_STD_RANGES()
+  namespace __mapped_chunks {
+    inline auto __page_size() noexcept -> std::size_t {
+      static const auto __size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+      return __size;
+    }
+
+    // The iterators carry the whole state of the chunking, so the chunks of a region form a
+    // borrowed range that iterate() can copy freely.
+    class __chunk_iterator {
+      const std::byte* __data_{nullptr};
+      std::size_t __size_{0};
+      std::size_t __chunk_size_{1};
+      std::size_t __offset_{0};
+
+     public:
+      using iterator_concept = std::forward_iterator_tag;
+      using value_type = std::span<const std::byte>;
+      using difference_type = std::ptrdiff_t;
+
+      __chunk_iterator() = default;
+
+      __chunk_iterator(
+        const std::byte* __data,
+        std::size_t __size,
+        std::size_t __chunk_size,
+        std::size_t __offset) noexcept
+        : __data_{__data}
+        , __size_{__size}
+        , __chunk_size_{__chunk_size}
+        , __offset_{__offset} {
+      }
+
+      auto operator*() const noexcept -> value_type {
+        return {__data_ + __offset_, std::min(__chunk_size_, __size_ - __offset_)};
+      }
+
+      auto operator++() noexcept -> __chunk_iterator& {
+        __offset_ = std::min(__offset_ + __chunk_size_, __size_);
+        return *this;
+      }
+
+      auto operator++(int) noexcept -> __chunk_iterator {
+        __chunk_iterator __copy = *this;
+        ++*this;
+        return __copy;
+      }
+
+      friend auto
+        operator==(const __chunk_iterator& __lhs, const __chunk_iterator& __rhs) noexcept -> bool {
+        return __lhs.__offset_ == __rhs.__offset_;
+      }
+    };
+
+    struct mapped_chunks_t {
+      /// @brief Returns a sequence sender that yields consecutive chunks of the region as
+      /// std::span<const std::byte>.
+      ///
+      /// The chunk size is rounded up to a multiple of the page size, so every chunk starts on
+      /// a page boundary. Only the last chunk may be shorter. The chunks refer to the mapped
+      /// memory directly; the region has to outlive the sequence.
+      auto operator()(const memory_mapped_region& __region, std::size_t __chunk_size) const {
+        const std::size_t __page = __page_size();
+        __chunk_size = std::max(__page, (__chunk_size + __page - 1) / __page * __page);
+        const auto* __data = static_cast<const std::byte*>(__region.data());
+        const std::size_t __size = __region.size();
+        return iterate(std::ranges::subrange{
+          __chunk_iterator{__data, __size, __chunk_size, 0},
+          __chunk_iterator{__data, __size, __chunk_size, __size}});
+      }
+    };
+  } // namespace __mapped_chunks
+
+  using __mapped_chunks::mapped_chunks_t;
+  inline constexpr mapped_chunks_t mapped_chunks{};
+#endif
+} // namespace exec
@@ -35,6 +35,10 @@ namespace exec {
 
     void reset(int __fd = -1) noexcept;
 
+    /// Gives up the ownership of the file descriptor without closing it.
+    [[nodiscard]]
+    auto release() noexcept -> int;
+
     explicit operator bool() const noexcept;
 
     operator int() const noexcept;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../../stdexec/concepts.hpp"
+#include "../../stdexec/execution.hpp"
+#include "../sequence_senders.hpp"
+#include "../timed_scheduler.hpp"
+
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+namespace exec {
+  /// What schedule_every() does with ticks that have passed while the receiver was busy with a
+  /// previous tick.
+  enum class missed_tick_policy {
+    /// Drop the missed ticks and continue with the first tick that is still ahead.
+    skip,
+    /// Emit the missed ticks back to back until the sequence has caught up.
+    burst
+  };
+
+  namespace __schedule_every {
+    using namespace stdexec;
+
+    template <class _Scheduler>
+    using __time_point_t = __decay_t<time_point_of_t<_Scheduler>>;
+
+    template <class _Scheduler>
+    using __item_t = decltype(stdexec::just(__declval<__time_point_t<_Scheduler>>()));
+
+    template <class _Scheduler>
+    using __timer_sender_t =
+      __call_result_t<schedule_at_t, const _Scheduler&, const __time_point_t<_Scheduler>&>;
+
+    template <class _Error>
+    auto __as_exception_ptr(_Error&& __error) noexcept -> std::exception_ptr {
+      if constexpr (same_as<__decay_t<_Error>, std::exception_ptr>) {
+        return static_cast<_Error&&>(__error);
+      } else if constexpr (same_as<__decay_t<_Error>, std::error_code>) {
+        return std::make_exception_ptr(std::system_error(__error));
+      } else {
+        return std::make_exception_ptr(static_cast<_Error&&>(__error));
+      }
+    }
+
+    template <class _Scheduler, class _ReceiverId>
+    struct __operation {
+      using _Receiver = stdexec::__t<_ReceiverId>;
+
+      class __t;
+
+      struct __timer_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __t* __op_;
+
+        void set_value() noexcept {
+          __op_->__emit();
+        }
+
+        template <class _Error>
+        void set_error(_Error&& __error) noexcept {
+          stdexec::set_error(
+            static_cast<_Receiver&&>(__op_->__rcvr_),
+            __schedule_every::__as_exception_ptr(static_cast<_Error&&>(__error)));
+        }
+
+        void set_stopped() noexcept {
+          stdexec::set_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+        }
+
+        auto get_env() const noexcept -> env_of_t<_Receiver> {
+          return stdexec::get_env(__op_->__rcvr_);
+        }
+      };
+
+      struct __next_receiver {
+        using receiver_concept = stdexec::receiver_t;
+        __t* __op_;
+
+        void set_value() noexcept {
+          __op_->__item_done();
+        }
+
+        void set_stopped() noexcept {
+          __set_value_unless_stopped(static_cast<_Receiver&&>(__op_->__rcvr_));
+        }
+
+        auto get_env() const noexcept -> env_of_t<_Receiver> {
+          return stdexec::get_env(__op_->__rcvr_);
+        }
+      };
+
+      using __time_point = __time_point_t<_Scheduler>;
+      using __duration = duration_of_t<_Scheduler>;
+      using __timer_operation_t = connect_result_t<__timer_sender_t<_Scheduler>, __timer_receiver>;
+      using __next_operation_t =
+        connect_result_t<next_sender_of_t<_Receiver, __item_t<_Scheduler>>, __next_receiver>;
+
+      // At most one tick is in flight at a time. The operations of the timer and of the item are
+      // constructed in place for each tick, so that ticks do not allocate.
+      class __t {
+        friend struct __timer_receiver;
+        friend struct __next_receiver;
+
+        _Scheduler __sched_;
+        __duration __period_;
+        missed_tick_policy __policy_;
+        _Receiver __rcvr_;
+        __time_point __deadline_{};
+        std::optional<__timer_operation_t> __timer_op_{};
+        std::optional<__next_operation_t> __next_op_{};
+
+        void __arm() noexcept {
+          try {
+            stdexec::start(__timer_op_.emplace(__emplace_from{[&] {
+              return stdexec::connect(
+                exec::schedule_at(std::as_const(__sched_), std::as_const(__deadline_)),
+                __timer_receiver{this});
+            }}));
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+          }
+        }
+
+        void __emit() noexcept {
+          try {
+            stdexec::start(__next_op_.emplace(__emplace_from{[&] {
+              return stdexec::connect(
+                exec::set_next(__rcvr_, stdexec::just(__deadline_)), __next_receiver{this});
+            }}));
+          } catch (...) {
+            stdexec::set_error(static_cast<_Receiver&&>(__rcvr_), std::current_exception());
+          }
+        }
+
+        // The deadlines are multiples of the period after the start of the sequence, so that
+        // late completions of the timer do not accumulate.
+        void __item_done() noexcept {
+          if (stdexec::get_stop_token(stdexec::get_env(__rcvr_)).stop_requested()) {
+            stdexec::set_stopped(static_cast<_Receiver&&>(__rcvr_));
+            return;
+          }
+          __deadline_ += __period_;
+          if (__policy_ == missed_tick_policy::skip) {
+            const __time_point __now = exec::now(__sched_);
+            if (__deadline_ < __now) {
+              __deadline_ += ((__now - __deadline_) / __period_ + 1) * __period_;
+            }
+          }
+          __arm();
+        }
+
+       public:
+        __t(
+          _Scheduler __sched,
+          __duration __period,
+          missed_tick_policy __policy,
+          _Receiver&& __rcvr)
+          : __sched_{static_cast<_Scheduler&&>(__sched)}
+          , __period_{__period}
+          , __policy_{__policy}
+          , __rcvr_{static_cast<_Receiver&&>(__rcvr)} {
+        }
+
+        void start() & noexcept {
+          __deadline_ = exec::now(__sched_) + __period_;
+          __arm();
+        }
+      };
+    };
+
+    template <class _Scheduler>
+    struct __sender {
+      struct __t {
+        using __id = __sender;
+        using sender_concept = sequence_sender_t;
+        using completion_signatures = stdexec::completion_signatures<
+          set_value_t(),
+          set_error_t(std::exception_ptr),
+          set_stopped_t()>;
+        using item_types = exec::item_types<__item_t<_Scheduler>>;
+
+        _Scheduler __sched_;
+        duration_of_t<_Scheduler> __period_;
+        missed_tick_policy __policy_;
+
+        template <__decays_to<__t> _Self, sequence_receiver_of<item_types> _Rcvr>
+        STDEXEC_MEMFN_DECL(auto subscribe)(this _Self&& __self, _Rcvr __rcvr)
+          -> stdexec::__t<__operation<_Scheduler, stdexec::__id<_Rcvr>>> {
+          return {
+            static_cast<_Self&&>(__self).__sched_,
+            __self.__period_,
+            __self.__policy_,
+            static_cast<_Rcvr&&>(__rcvr)};
+        }
+      };
+    };
+
+    struct schedule_every_t {
+      template <timed_scheduler _Scheduler>
+      auto operator()(
+        _Scheduler __sched,
+        duration_of_t<_Scheduler> __period,
+        missed_tick_policy __policy = missed_tick_policy::skip) const
+        noexcept(__nothrow_move_constructible<_Scheduler>) -> __t<__sender<_Scheduler>> {
+        // The comparison of durations is not noexcept, which STDEXEC_ASSERT requires.
+        [[maybe_unused]] const bool __positive = __period > duration_of_t<_Scheduler>::zero();
+        STDEXEC_ASSERT(__positive);
+        return {static_cast<_Scheduler&&>(__sched), __period, __policy};
+      }
+    };
+  } // namespace __schedule_every
+
+  using __schedule_every::schedule_every_t;
+
+  /// @brief Returns a sequence sender that yields the time point of each tick of a period on a
+  /// timed scheduler, starting one period after the sequence is started.
+  ///
+  /// The n-th tick is due n periods after the start, regardless of how late the previous ticks
+  /// completed, so the ticks do not drift. The next tick is scheduled once the receiver is done
+  /// with the previous one; the policy decides what happens with the ticks that have passed in
+  /// the meantime. The sequence runs until it is stopped, either by the receiver or by an item
+  /// that completes with set_stopped(). The period must be positive.
+  inline constexpr schedule_every_t schedule_every{};
+} // namespace exec
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "./timed_thread_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace exec {
+  class sharded_timed_thread_scheduler;
+
+  /// A timer service that spreads its timers over several timed_thread_contexts, the shards.
+  /// Each shard has its own thread, command queue and timer store. A timer is started on the
+  /// shard of the thread that connects it, so that producers on different threads do not
+  /// contend with each other. Cancellation goes to the shard that holds the timer.
+  class sharded_timed_thread_context {
+   public:
+    explicit sharded_timed_thread_context(
+      std::size_t n_shards = std::thread::hardware_concurrency(),
+      const timed_thread_context_options& options = {}) {
+      n_shards = std::max<std::size_t>(n_shards, 1);
+      shards_.reserve(n_shards);
+      // Each shard is allocated separately, so that shards do not share cache lines.
+      for (std::size_t i = 0; i < n_shards; ++i) {
+        shards_.push_back(std::make_unique<timed_thread_context>(options));
+      }
+    }
+
+    sharded_timed_thread_scheduler get_scheduler() noexcept;
+
+    [[nodiscard]]
+    std::size_t n_shards() const noexcept {
+      return shards_.size();
+    }
+
+    /// Returns the shard that takes the timers of the calling thread.
+    timed_thread_context& local_shard() noexcept {
+      return *shards_[this_thread_slot() % shards_.size()];
+    }
+
+   private:
+    // Threads are assigned slots round robin on first use, which spreads them evenly over the
+    // shards.
+    static std::size_t this_thread_slot() noexcept {
+      static std::atomic<std::size_t> next_slot{0};
+      thread_local const std::size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+      return slot;
+    }
+
+    std::vector<std::unique_ptr<timed_thread_context>> shards_;
+  };
+
+  class sharded_timed_thread_scheduler {
+   public:
+    using time_point = std::chrono::steady_clock::time_point;
+    using duration = std::chrono::steady_clock::duration;
+
+    class schedule_at {
+     public:
+      using sender_concept = stdexec::sender_t;
+      using completion_signatures =
+        stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_stopped_t()>;
+
+      schedule_at(sharded_timed_thread_context& context, time_point tp) noexcept
+        : context_{&context}
+        , time_point_{tp} {
+      }
+
+      auto get_env() const noexcept {
+        return stdexec::prop{
+          stdexec::get_completion_scheduler<stdexec::set_value_t>,
+          sharded_timed_thread_scheduler{*context_}};
+      }
+
+      template <class Receiver>
+      auto connect(Receiver receiver) const & noexcept ->
+        typename _time_thrd_sched::timed_thread_schedule_at_op<Receiver>::__t {
+        return exec::schedule_at(context_->local_shard().get_scheduler(), time_point_)
+          .connect(std::move(receiver));
+      }
+
+     private:
+      sharded_timed_thread_context* context_;
+      time_point time_point_;
+    };
+
+    /// A scheduler whose timers complete on a target scheduler instead of the thread of a shard,
+    /// which keeps long-running continuations off the shards.
+    template <stdexec::scheduler Target>
+    class targeted_scheduler {
+     public:
+      using time_point = std::chrono::steady_clock::time_point;
+      using duration = std::chrono::steady_clock::duration;
+
+      class schedule_at {
+        using sender_t = decltype(stdexec::continue_on(
+          std::declval<sharded_timed_thread_scheduler::schedule_at>(),
+          std::declval<const Target&>()));
+
+       public:
+        using sender_concept = stdexec::sender_t;
+
+        schedule_at(sharded_timed_thread_context& context, time_point tp, Target target) noexcept
+          : context_{&context}
+          , time_point_{tp}
+          , target_{std::move(target)} {
+        }
+
+        auto get_env() const noexcept {
+          return stdexec::prop{
+            stdexec::get_completion_scheduler<stdexec::set_value_t>,
+            targeted_scheduler{*context_, target_}};
+        }
+
+        template <class Env>
+        auto get_completion_signatures(Env&&) const noexcept
+          -> stdexec::completion_signatures_of_t<sender_t, Env> {
+          return {};
+        }
+
+        template <stdexec::receiver Receiver>
+          requires stdexec::sender_to<sender_t, Receiver>
+        auto connect(Receiver receiver) const & -> stdexec::connect_result_t<sender_t, Receiver> {
+          return stdexec::connect(
+            stdexec::continue_on(
+              sharded_timed_thread_scheduler::schedule_at{*context_, time_point_}, target_),
+            std::move(receiver));
+        }
+
+       private:
+        sharded_timed_thread_context* context_;
+        time_point time_point_;
+        Target target_;
+      };
+
+      targeted_scheduler(sharded_timed_thread_context& context, Target target) noexcept
+        : context_{&context}
+        , target_{std::move(target)} {
+      }
+
+      STDEXEC_MEMFN_DECL(auto now)(this const targeted_scheduler&) noexcept -> time_point {
+        return std::chrono::steady_clock::now();
+      }
+
+      STDEXEC_MEMFN_DECL(
+        auto schedule_at)(this const targeted_scheduler& self, time_point tp) noexcept
+        -> schedule_at {
+        return schedule_at{*self.context_, tp, self.target_};
+      }
+
+      auto schedule() const noexcept -> schedule_at {
+        return exec::schedule_at(*this, time_point());
+      }
+
+      auto operator==(const targeted_scheduler&) const noexcept -> bool = default;
+
+     private:
+      sharded_timed_thread_context* context_;
+      Target target_;
+    };
+
+    explicit sharded_timed_thread_scheduler(sharded_timed_thread_context& context) noexcept
+      : context_{&context} {
+    }
+
+    STDEXEC_MEMFN_DECL(auto now)(this const sharded_timed_thread_scheduler&) noexcept
+      -> time_point {
+      return std::chrono::steady_clock::now();
+    }
+
+    STDEXEC_MEMFN_DECL(
+      auto schedule_at)(this const sharded_timed_thread_scheduler& self, time_point tp) noexcept
+      -> schedule_at {
+      return schedule_at{*self.context_, tp};
+    }
+
+    auto schedule() const noexcept -> schedule_at {
+      return exec::schedule_at(*this, time_point());
+    }
+
+    /// Returns a scheduler for the same shards whose timers complete on target.
+    template <stdexec::scheduler Target>
+    auto completing_on(Target target) const noexcept -> targeted_scheduler<Target> {
+      return targeted_scheduler<Target>{*context_, std::move(target)};
+    }
+
+    auto operator==(const sharded_timed_thread_scheduler&) const noexcept -> bool = default;
+
+   private:
+    sharded_timed_thread_context* context_;
+  };
+
+  inline sharded_timed_thread_scheduler sharded_timed_thread_context::get_scheduler() noexcept {
+    return sharded_timed_thread_scheduler{*this};
+  }
+} // namespace exec
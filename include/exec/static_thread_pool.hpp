@@ -402,6 +402,7 @@ namespace exec {
           std::size_t threadIndex) noexcept
           : pool_(&pool)
           , queue_{&queue}
+          , nodemask_{&nodemask::any()}
           , thread_idx_{threadIndex} {
         }
 
@@ -483,7 +484,32 @@ namespace exec {
         std::size_t tasks_size,
         const nodemask& constraints = nodemask::any()) noexcept;
 
+      // Tasks without constraints that the calling thread enqueues between begin_enqueue_batch()
+      // and end_enqueue_batch() are collected and handed to the worker threads at once. This
+      // takes one push and one notification per worker instead of one per task, which pays off
+      // for threads outside the pool that start many tasks in a row, e.g. an io event loop.
+      // A thread has at most one open batch. Beginning a batch flushes the open batch of
+      // another pool. A batch is also handed over once it holds max_enqueue_batch_size tasks.
+      //
+      // While its batch is open, a thread must not block on a task that it enqueued, e.g. with
+      // sync_wait(), since the task may not have been handed to a worker yet.
+      void begin_enqueue_batch() noexcept;
+      void end_enqueue_batch() noexcept;
+
+      static constexpr std::size_t max_enqueue_batch_size = 64;
+
      private:
+      struct enqueue_batch {
+        static_thread_pool_* pool_{nullptr};
+        __intrusive_queue<&task_base::next> tasks_{};
+        std::size_t size_{0};
+      };
+
+      static auto this_thread_batch() noexcept -> enqueue_batch& {
+        static thread_local enqueue_batch batch{};
+        return batch;
+      }
+
       class workstealing_victim {
        public:
         explicit workstealing_victim(
@@ -783,6 +809,15 @@ namespace exec {
       remote_queue& queue,
       task_base* task,
       const nodemask& constraints) noexcept {
+      enqueue_batch& batch = this_thread_batch();
+      if (batch.pool_ == this && constraints == nodemask::any()) {
+        batch.tasks_.push_back(task);
+        if (++batch.size_ == max_enqueue_batch_size) {
+          bulk_enqueue(
+            *get_remote_queue(), std::move(batch.tasks_), std::exchange(batch.size_, 0));
+        }
+        return;
+      }
       static thread_local std::thread::id this_id = std::this_thread::get_id();
       remote_queue* correct_queue = this_id == queue.id_ ? &queue : get_remote_queue();
       std::size_t idx = correct_queue->index_;
@@ -850,6 +885,28 @@ namespace exec {
       }
     }
 
+    inline void static_thread_pool_::begin_enqueue_batch() noexcept {
+      enqueue_batch& batch = this_thread_batch();
+      if (batch.pool_ != this) {
+        if (batch.pool_ != nullptr) {
+          batch.pool_->end_enqueue_batch();
+        }
+        batch.pool_ = this;
+      }
+    }
+
+    inline void static_thread_pool_::end_enqueue_batch() noexcept {
+      enqueue_batch& batch = this_thread_batch();
+      if (batch.pool_ != this) {
+        return;
+      }
+      batch.pool_ = nullptr;
+      if (batch.size_ != 0) {
+        bulk_enqueue(
+          *get_remote_queue(), std::move(batch.tasks_), std::exchange(batch.size_, 0));
+      }
+    }
+
     inline void move_pending_to_local(
       __intrusive_queue<&task_base::next>& pending_queue,
       bwos::lifo_queue<task_base*, numa_allocator<task_base*>>& local_queue) {
@@ -1578,6 +1635,15 @@ namespace exec {
 
     // bwos_params params() const;
     using _pool_::static_thread_pool_::params;
+
+    // void begin_enqueue_batch() noexcept;
+    using _pool_::static_thread_pool_::begin_enqueue_batch;
+
+    // void end_enqueue_batch() noexcept;
+    using _pool_::static_thread_pool_::end_enqueue_batch;
+
+    // static constexpr std::size_t max_enqueue_batch_size;
+    using _pool_::static_thread_pool_::max_enqueue_batch_size;
   };
 
 #if STDEXEC_HAS_STD_RANGES()
@@ -19,13 +19,18 @@
 #include "__detail/__system_context_replaceability_api.hpp"
 
 #ifndef STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE
-#  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE 72
+// The operations of the thread pool of the default backend also record a NUMA node.
+#  if STDEXEC_ENABLE_NUMA
+#    define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE 80
+#  else
+#    define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE 72
+#  endif
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN
 #  define STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN 8
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE
-#  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE 152
+#  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE 160
 #endif
 #ifndef STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN
 #  define STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN 8
@@ -64,6 +69,14 @@ namespace exec {
     template <class _Sender>
     using __sender_data_t = decltype(stdexec::sync_wait(std::declval<_Sender>()).value());
 
+    /// Whether storage of the given size and alignment satisfies the requirements of a backend.
+    inline auto __satisfies(
+      system_context_replaceability::storage_requirements __needed,
+      size_t __size,
+      size_t __alignment) noexcept -> bool {
+      return __needed.__size <= __size && __needed.__alignment <= __alignment;
+    }
+
   } // namespace __detail
 
   class system_scheduler;
@@ -92,8 +105,28 @@ namespace exec {
    private:
     /// The actual implementation of the system context.
     system_context_replaceability::system_scheduler* __impl_{nullptr};
+    /// The implementation of the system context that takes scheduling hints, if there is one.
+    system_context_replaceability::system_scheduler_with_hints* __hinted_impl_{nullptr};
+  };
+
+  /// Hints on how work scheduled on a `system_scheduler` should run.
+  using schedule_hints = system_context_replaceability::schedule_hints;
+
+  /// Query for the system-wide I/O context of type `_Context`, e.g. `exec::io_uring_context`.
+  /// A `system_scheduler` answers it with the context of the I/O backend, or with a null pointer
+  /// if there is no I/O backend or its context has a different type.
+  template <class _Context>
+  struct get_system_io_context_t {
+    template <class _Env>
+      requires stdexec::tag_invocable<get_system_io_context_t, const _Env&>
+    auto operator()(const _Env& __env) const noexcept -> _Context* {
+      return stdexec::tag_invoke(get_system_io_context_t{}, __env);
+    }
   };
 
+  template <class _Context>
+  inline constexpr get_system_io_context_t<_Context> get_system_io_context{};
+
   /// The execution domain of the system_scheduler, used for the purposes of customizing
   /// sender algorithms such as `bulk`.
   struct system_scheduler_domain : stdexec::default_domain {
@@ -105,8 +138,43 @@ namespace exec {
   };
 
   namespace __detail {
+    /// The implementation of a scheduler, and the hints that the scheduler passes to it.
+    struct __backend_ref {
+      /// The underlying implementation of the scheduler.
+      system_context_replaceability::system_scheduler* __impl_;
+      /// The implementation that takes hints; `nullptr` if the backend does not support hints.
+      system_context_replaceability::system_scheduler_with_hints* __hinted_impl_;
+      /// The hints to pass to the implementation.
+      schedule_hints __hints_;
+
+      /// Schedules work on the implementation, passing the hints if there are any.
+      void __schedule(
+        system_context_replaceability::storage __s,
+        system_context_replaceability::receiver* __r) const noexcept {
+        if (__hinted_impl_ != nullptr && __hints_ != schedule_hints{}) {
+          __hinted_impl_->schedule(__s, __r, __hints_);
+        } else {
+          __impl_->schedule(__s, __r);
+        }
+      }
+
+      /// Schedules bulk work on the implementation, passing the hints if there are any.
+      void __bulk_schedule(
+        uint32_t __n,
+        system_context_replaceability::storage __s,
+        system_context_replaceability::bulk_item_receiver* __r) const noexcept {
+        if (__hinted_impl_ != nullptr && __hints_ != schedule_hints{}) {
+          __hinted_impl_->bulk_schedule(__n, __s, __r, __hints_);
+        } else {
+          __impl_->bulk_schedule(__n, __s, __r);
+        }
+      }
+
+      bool operator==(const __backend_ref&) const noexcept = default;
+    };
+
     template <class T>
-    auto __make_system_scheduler_from(T, system_context_replaceability::system_scheduler*) noexcept;
+    auto __make_system_scheduler_from(T, const __backend_ref&) noexcept;
 
     /// Describes the environment of this sender.
     struct __system_scheduler_env {
@@ -117,7 +185,7 @@ namespace exec {
       }
 
       /// The underlying implementation of the scheduler we are using.
-      system_context_replaceability::system_scheduler* __scheduler_;
+      __backend_ref __scheduler_;
     };
 
     template <size_t _Size, size_t _Align>
@@ -145,9 +213,9 @@ namespace exec {
     schedule:
     - __receiver_adapter::__vtable -- 8
     - __receiver_adapter::__rcvr_ (Rcvr) -- assuming 0
-    - __system_op::__preallocated_ (__preallocated) -- 72
+    - __system_op::__preallocated_ (__preallocated) -- 72 (80 with STDEXEC_ENABLE_NUMA)
     ---------------------
-    Total: 80; extra 8 bytes compared to backend needs.
+    Total: 80 (88 with STDEXEC_ENABLE_NUMA); extra 8 bytes compared to backend needs.
 
     for bulk:
     - __bulk_state_base::__fun_ (_Fn) -- 0 (assuming empty function)
@@ -155,26 +223,31 @@ namespace exec {
     - __forward_args_receiver::__vtable -- 8
     - __forward_args_receiver::__arguments_data_ (array of bytes) -- 8 (depending on previous sender)
     - __bulk_state_base::__prepare_storage_for_backend (fun ptr) -- 8
-    - __bulk_state::__preallocated_ (__preallocated_) -- 152
-      - __previous_operation_state_ (__inner_op_state) -- 104
+    - __bulk_state::__preallocated_ (__preallocated_) -- 160
+      - __previous_operation_state_ (__inner_op_state) -- 128
         - __bulk_intermediate_receiver::__state_ (__state_&) -- 8
-        - __bulk_intermediate_receiver::__scheduler_ (system_scheduler*) -- 8
+        - __bulk_intermediate_receiver::__scheduler_ (__backend_ref) -- 32
         - __bulk_intermediate_receiver::__size_ (_Size) -- 4
     ---------------------
-    Total: 176; extra 24 bytes compared to backend needs.
+    Total: 184; extra 24 bytes compared to backend needs.
 
-    [*] sizes taken on an Apple M2 Pro arm64 arch. They may differ on other architectures, or with different implementations.
+    The storage sizes can be configured with STDEXEC_SYSTEM_CONTEXT_{,BULK_}SCHEDULE_OP_{SIZE,ALIGN}.
+    `system_context` asserts that they satisfy what the backend publishes through
+    `system_scheduler_storage`.
+
+    [*] sizes taken on x86-64 with libstdc++, like those of the default backend. They may differ on other architectures, or with different implementations.
     */
 
     /// The operation state used to execute the work described by this sender.
     template <class _S, class _Rcvr>
     struct __system_op {
       /// Constructs `this` from `__rcvr` and `__scheduler_impl`.
-      __system_op(_Rcvr&& __rcvr, system_context_replaceability::system_scheduler* __scheduler_impl)
+      __system_op(_Rcvr&& __rcvr, const __backend_ref& __scheduler_impl)
         : __rcvr_{std::forward<_Rcvr>(__rcvr)} {
         // Before the operation starts, we store the scheduelr implementation in __preallocated_.
         // After the operation starts, we don't need this pointer anymore, and the storage can be used by the backend
-        __preallocated_.__as<system_context_replaceability::system_scheduler*>() = __scheduler_impl;
+        static_assert(sizeof(__backend_ref) <= STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE);
+        new (__preallocated_.__as_ptr()) __backend_ref{__scheduler_impl};
       }
 
       ~__system_op() = default;
@@ -186,9 +259,9 @@ namespace exec {
 
       /// Starts the work stored in `this`.
       void start() & noexcept {
-        auto* __scheduler_impl =
-          __preallocated_.__as<system_context_replaceability::system_scheduler*>();
-        __scheduler_impl->schedule(__preallocated_.__as_storage(), &__rcvr_);
+        // Copy the implementation out of the storage, before the backend reuses the storage.
+        auto __scheduler_impl = __preallocated_.__as<__backend_ref>();
+        __scheduler_impl.__schedule(__preallocated_.__as_storage(), &__rcvr_);
       }
 
       /// Object that receives completion from the work described by the sender.
@@ -215,7 +288,7 @@ namespace exec {
       stdexec::set_error_t(std::exception_ptr)>;
 
     /// Implementation detail. Constructs the sender to wrap `__impl`.
-    system_sender(system_context_replaceability::system_scheduler* __impl)
+    system_sender(const __detail::__backend_ref& __impl)
       : __scheduler_{__impl} {
     }
 
@@ -233,7 +306,7 @@ namespace exec {
 
    private:
     /// The underlying implementation of the system scheduler.
-    system_context_replaceability::system_scheduler* __scheduler_;
+    __detail::__backend_ref __scheduler_;
   };
 
   /// A scheduler that can add work to the system context.
@@ -245,7 +318,7 @@ namespace exec {
     bool operator==(const system_scheduler&) const noexcept = default;
 
     /// Implementation detail. Constructs the scheduler to wrap `__impl`.
-    system_scheduler(system_context_replaceability::system_scheduler* __impl)
+    system_scheduler(const __detail::__backend_ref& __impl)
       : __impl_(__impl) {
     }
 
@@ -258,17 +331,42 @@ namespace exec {
       return {};
     }
 
+    /// Returns the system-wide I/O context if it has the type `_Context`, or a null pointer.
+    template <system_context_replaceability::__identified_io_context _Context>
+    auto query(get_system_io_context_t<_Context>) const noexcept -> _Context* {
+      auto* __io = system_context_replaceability::query_system_context<
+        system_context_replaceability::system_io_context>();
+      if (
+        __io == nullptr
+        || __io->io_context_id()
+             != system_context_replaceability::io_context_identifier<_Context>::value) {
+        return nullptr;
+      }
+      return static_cast<_Context*>(__io->get_io_context());
+    }
+
     /// Schedules new work, returning the sender that signals the start of the work.
     system_sender schedule() const noexcept {
       return {__impl_};
     }
 
+    /// Returns a scheduler for the same context that passes `__hints` to the backend, for the
+    /// work scheduled with it, including bulk work. Backends may ignore the hints.
+    system_scheduler with_hints(const schedule_hints& __hints) const noexcept {
+      return __detail::__backend_ref{__impl_.__impl_, __impl_.__hinted_impl_, __hints};
+    }
+
+    /// Returns the hints this scheduler passes to the backend.
+    const schedule_hints& hints() const noexcept {
+      return __impl_.__hints_;
+    }
+
    private:
     template <stdexec::sender, std::integral, class>
     friend class system_bulk_sender;
 
     /// The underlying implementation of the scheduler.
-    system_context_replaceability::system_scheduler* __impl_;
+    __detail::__backend_ref __impl_;
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,8 +374,7 @@ namespace exec {
 
   namespace __detail {
     template <class T>
-    auto
-      __make_system_scheduler_from(T, system_context_replaceability::system_scheduler* p) noexcept {
+    auto __make_system_scheduler_from(T, const __backend_ref& p) noexcept {
       return system_scheduler{p};
     }
 
@@ -336,6 +433,18 @@ namespace exec {
           [&](auto&&... __args) { __state->__fun_(__index, __args...); },
           *reinterpret_cast<std::tuple<_As...>*>(__base_t::__arguments_data_));
       }
+
+      /// Calls the bulk functor for each index in `[__begin, __end)`, passing the values from the previous sender.
+      void start(uint32_t __begin, uint32_t __end) noexcept override {
+        auto __state = reinterpret_cast<_BulkState*>(this);
+        std::apply(
+          [&](auto&&... __args) {
+            for (uint32_t __index = __begin; __index < __end; ++__index) {
+              __state->__fun_(__index, __args...);
+            }
+          },
+          *reinterpret_cast<std::tuple<_As...>*>(__base_t::__arguments_data_));
+      }
     };
 
     /// The state needed to execute the bulk sender created from system context, minus the preallocates space.
@@ -377,7 +486,7 @@ namespace exec {
       /// Object that holds the relevant data for the entire bulk operation.
       _BulkState& __state_;
       /// The underlying implementation of the scheduler we are using.
-      system_context_replaceability::system_scheduler* __scheduler_{nullptr};
+      __backend_ref __scheduler_;
       /// The size of the bulk operation.
       _Size __size_;
 
@@ -397,7 +506,7 @@ namespace exec {
 
         // Schedule the bulk work on the system scheduler.
         // This will invoke `start` on our receiver multiple times, and then a completion signal (e.g., `set_value`).
-        __scheduler->bulk_schedule(__size, __storage, __r);
+        __scheduler.__bulk_schedule(__size, __storage, __r);
       }
 
       /// Invoked when the previous sender completes with "stopped" to stop the entire work.
@@ -531,7 +640,7 @@ namespace exec {
 
    private:
     /// The underlying implementation of the scheduler we are using.
-    system_context_replaceability::system_scheduler* __scheduler_{nullptr};
+    __detail::__backend_ref __scheduler_;
     /// The previous sender, the one that produces the input value for the bulk function.
     _Previous __previous_;
     /// The size of the bulk operation.
@@ -547,10 +656,27 @@ namespace exec {
     if (!__impl_) {
       throw std::runtime_error{"No system context implementation found"};
     }
+    // Optional; without it, schedulers ignore their hints.
+    __hinted_impl_ = system_context_replaceability::query_system_context<
+      system_context_replaceability::system_scheduler_with_hints>();
+    // Optional as well. A backend that needs more storage than the frontend provides still
+    // works in release builds, but has to place its operations elsewhere. Debug builds catch
+    // storage sizes that have not been raised for such a backend.
+    if (auto* __storage = system_context_replaceability::query_system_context<
+          system_context_replaceability::system_scheduler_storage>()) {
+      STDEXEC_ASSERT(__detail::__satisfies(
+        __storage->schedule_storage(),
+        STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE,
+        STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN));
+      STDEXEC_ASSERT(__detail::__satisfies(
+        __storage->bulk_schedule_storage(),
+        STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE,
+        STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN));
+    }
   }
 
   inline system_scheduler system_context::get_scheduler() {
-    return system_scheduler{__impl_};
+    return system_scheduler{__detail::__backend_ref{__impl_, __hinted_impl_, {}}};
   }
 
   inline size_t system_context::max_concurrency() const noexcept {
@@ -18,16 +18,45 @@
 #pragma once
 
 #include "./timed_scheduler.hpp"
+#include "./__detail/intrusive_dary_heap.hpp"
 #include "./__detail/intrusive_heap.hpp"
+#include "./__detail/intrusive_timer_wheel.hpp"
 
 #include "../stdexec/__detail/__intrusive_mpsc_queue.hpp"
+#include "../stdexec/__detail/__intrusive_queue.hpp"
 #include "../stdexec/__detail/__spin_loop_pause.hpp"
 
+#include <algorithm>
 #include <bit>
 
 namespace exec {
   class timed_thread_scheduler;
 
+  /// The data structure that keeps the pending timers of a timed_thread_context.
+  enum class timed_thread_timer_store {
+    /// A binary heap that links the timers through pointers. Inserting and cancelling a timer
+    /// takes O(log n) time.
+    heap,
+    /// A 4-ary heap that is stored in an array. Inserting and cancelling a timer takes O(log n)
+    /// time, but the heap is shallower and sifting touches fewer cache lines than the binary
+    /// heap. The array grows as needed.
+    dary_heap,
+    /// A hierarchical timing wheel. Inserting and cancelling a timer takes constant time, which
+    /// pays off for large numbers of timers that are mostly cancelled before they expire, such
+    /// as request timeouts. Deadlines are rounded up to the resolution of the wheel.
+    wheel
+  };
+
+  struct timed_thread_context_options {
+    timed_thread_timer_store timer_store = timed_thread_timer_store::heap;
+    /// The length of one tick of the timing wheel.
+    std::chrono::steady_clock::duration wheel_resolution = std::chrono::milliseconds{1};
+    /// How much later than its deadline a timer may complete by default. Timers whose windows
+    /// overlap complete in one wake-up of the context thread. See
+    /// timed_thread_scheduler::with_slack() for the slack of individual timers.
+    std::chrono::steady_clock::duration timer_slack{0};
+  };
+
   namespace _time_thrd_sched {
     using namespace stdexec::tags;
 
@@ -69,24 +98,52 @@ namespace exec {
 
     struct timed_thread_schedule_operation_base : timed_thread_operation_base {
       using time_point = std::chrono::steady_clock::time_point;
+      using duration = std::chrono::steady_clock::duration;
+
+      enum class location_type {
+        queued,
+        stored,
+        expired
+      };
 
       timed_thread_schedule_operation_base(
         time_point tp,
+        duration slack,
         void (*set_stopped)(timed_thread_operation_base*) noexcept,
         void (*set_value)(timed_thread_operation_base*) noexcept) noexcept
         : timed_thread_operation_base{set_value, command_type::schedule}
         , time_point_{tp}
+        , latest_{latest_time_point(tp, slack)}
         , set_stopped_{set_stopped} {
       }
 
+      static time_point latest_time_point(time_point tp, duration slack) noexcept {
+        if (slack <= duration::zero()) {
+          return tp;
+        }
+        return tp > time_point::max() - slack ? time_point::max() : tp + slack;
+      }
+
+      // the operation completes at some point between time_point_ and latest_
       time_point time_point_;
-      // we increase the when counter to ensure that the heap is stable
-      // when two operations have the same time_point
+      time_point latest_;
+      // The heaps are ordered by latest_. We increase the when counter to ensure that the
+      // heap is stable when two operations have the same time_point
       // We do so only when the operation is started, not when it is constructed
       when_type<time_point> when_{};
       timed_thread_schedule_operation_base* prev_ = nullptr;
       timed_thread_schedule_operation_base* left_ = nullptr;
       timed_thread_schedule_operation_base* right_ = nullptr;
+      // position in the d-ary heap
+      std::size_t heap_index_ = 0;
+      // links of the timing wheel
+      timed_thread_schedule_operation_base** wheel_prev_ = nullptr;
+      timed_thread_schedule_operation_base* wheel_next_ = nullptr;
+      // link of the tasks that have been taken from the store and are about to complete
+      timed_thread_schedule_operation_base* expired_next_ = nullptr;
+      // whether the task is in the command queue, in the store or has been taken out of it.
+      // Guarded by the store mutex of the context.
+      location_type location_ = location_type::queued;
       void (*set_stopped_)(timed_thread_operation_base*) noexcept;
     };
 
@@ -112,7 +169,14 @@ namespace exec {
     static constexpr std::ptrdiff_t context_closed = std::numeric_limits<std::ptrdiff_t>::min() / 2;
    public:
     timed_thread_context() noexcept
-      : run_thread_(&timed_thread_context::run, this) {
+      : timed_thread_context(timed_thread_context_options{}) {
+    }
+
+    explicit timed_thread_context(const timed_thread_context_options& options) noexcept
+      : timer_slack_{std::max(options.timer_slack, std::chrono::steady_clock::duration::zero())}
+      , timer_store_{options.timer_store}
+      , wheel_{options.wheel_resolution, std::chrono::steady_clock::now()}
+      , run_thread_(&timed_thread_context::run, this) {
     }
 
     ~timed_thread_context() {
@@ -130,49 +194,210 @@ namespace exec {
     using task_type = _time_thrd_sched::timed_thread_schedule_operation_base;
     using stop_type = _time_thrd_sched::timed_thread_stop_operation;
     using time_point = std::chrono::steady_clock::time_point;
+    using location_type = task_type::location_type;
+    using task_queue = stdexec::__intrusive_queue<&task_type::expired_next_>;
+
+    // The run thread terminates if the d-ary heap fails to grow.
+    void insert(task_type* task) noexcept {
+      task->location_ = location_type::stored;
+      switch (timer_store_) {
+      case timed_thread_timer_store::heap:
+        task->when_ = _time_thrd_sched::when_type{task->latest_, submission_counter_++};
+        heap_.insert(task);
+        break;
+      case timed_thread_timer_store::dary_heap:
+        task->when_ = _time_thrd_sched::when_type{task->latest_, submission_counter_++};
+        dary_heap_.insert(task);
+        break;
+      case timed_thread_timer_store::wheel:
+        wheel_.insert(task);
+        break;
+      }
+    }
 
-    void run() {
-      while (true) {
-        while (command_type* op = command_queue_.pop_front()) {
-          if (op->command_ == command_type::command_type::schedule) {
-            task_type* task = static_cast<task_type*>(op);
-            task->when_ = _time_thrd_sched::when_type{task->time_point_, submission_counter_++};
-            heap_.insert(task);
-          } else {
-            STDEXEC_ASSERT(op->command_ == command_type::command_type::stop);
-            stop_type* stop_op = static_cast<stop_type*>(op);
-            if (heap_.erase(stop_op->target_)) {
-              stop_op->target_->set_stopped_(stop_op->target_);
-            }
-            stop_op->set_value_(stop_op);
-          }
+    bool erase(task_type* task) noexcept {
+      task->location_ = location_type::expired;
+      switch (timer_store_) {
+      case timed_thread_timer_store::heap:
+        return heap_.erase(task);
+      case timed_thread_timer_store::dary_heap:
+        return dary_heap_.erase(task);
+      case timed_thread_timer_store::wheel:
+        return wheel_.erase(task);
+      }
+      return false;
+    }
+
+    static void take(task_queue& expired, task_type* op) noexcept {
+      op->location_ = location_type::expired;
+      expired.push_back(op);
+    }
+
+    // Like hrtimers in Linux, this takes tasks in the order of their latest completion time and
+    // stops at the first task whose deadline has not been reached yet. No task remains whose
+    // latest completion time has been reached, since they come first.
+    template <class Heap>
+    static std::optional<time_point>
+      take_expired(Heap& heap, time_point now, task_queue& expired) noexcept {
+      task_type* op = heap.front();
+      while (op && op->time_point_ <= now) {
+        heap.pop_front();
+        take(expired, op);
+        op = heap.front();
+      }
+      return op ? std::optional{op->latest_} : std::nullopt;
+    }
+
+    // Takes all tasks that are due out of the store and returns the time at which the context
+    // thread has to wake up next, if any. That is the earliest latest completion time of the
+    // remaining tasks, so that tasks with overlapping windows complete in one wake-up.
+    std::optional<time_point> take_expired(time_point now, task_queue& expired) noexcept {
+      switch (timer_store_) {
+      case timed_thread_timer_store::heap:
+        return take_expired(heap_, now, expired);
+      case timed_thread_timer_store::dary_heap:
+        return take_expired(dary_heap_, now, expired);
+      case timed_thread_timer_store::wheel:
+        wheel_.expire(now, [&expired](task_type* op) noexcept { take(expired, op); });
+        return wheel_.next_expiry();
+      }
+      return std::nullopt;
+    }
+
+    template <class Heap>
+    static void take_all(Heap& heap, task_queue& expired) noexcept {
+      task_type* op = heap.front();
+      while (op) {
+        heap.pop_front();
+        take(expired, op);
+        op = heap.front();
+      }
+    }
+
+    void take_all(task_queue& expired) noexcept {
+      switch (timer_store_) {
+      case timed_thread_timer_store::heap:
+        take_all(heap_, expired);
+        break;
+      case timed_thread_timer_store::dary_heap:
+        take_all(dary_heap_, expired);
+        break;
+      case timed_thread_timer_store::wheel:
+        wheel_.clear([&expired](task_type* op) noexcept { take(expired, op); });
+        break;
+      }
+    }
+
+    // Completes all tasks that are due and returns the time of the next wake-up. The tasks
+    // complete without holding the store mutex, so that they can cancel other tasks. The lock
+    // may already own the mutex from inserting new tasks.
+    std::optional<time_point>
+      expire(time_point now, std::unique_lock<std::mutex>& store_lock) noexcept {
+      task_queue expired{};
+      if (!store_lock.owns_lock()) {
+        store_lock.lock();
+      }
+      std::optional<time_point> wake_up = take_expired(now, expired);
+      store_lock.unlock();
+      while (!expired.empty()) {
+        task_type* op = expired.pop_front();
+        op->set_value_(op);
+      }
+      return wake_up;
+    }
+
+    void stop_all(std::unique_lock<std::mutex>& store_lock) noexcept {
+      task_queue expired{};
+      if (!store_lock.owns_lock()) {
+        store_lock.lock();
+      }
+      take_all(expired);
+      store_lock.unlock();
+      while (!expired.empty()) {
+        task_type* op = expired.pop_front();
+        op->set_stopped_(op);
+      }
+    }
+
+    // Cancels the target of a stop operation on the calling thread if the context thread has
+    // put the target into the store, which spares the round trip through the context thread.
+    // The store mutex is only held to unlink the target.
+    void cancel(stop_type* stop_op) noexcept {
+      task_type* target = stop_op->target_;
+      std::unique_lock lock{store_mutex_};
+      switch (target->location_) {
+      case location_type::stored:
+        erase(target);
+        lock.unlock();
+        target->set_stopped_(target);
+        stop_op->set_value_(stop_op);
+        break;
+      case location_type::expired:
+        // The context thread completes the target.
+        lock.unlock();
+        stop_op->set_value_(stop_op);
+        break;
+      case location_type::queued:
+        lock.unlock();
+        schedule(stop_op);
+        break;
+      }
+    }
+
+    // Moves new tasks into the store and completes the stop commands. The store mutex is taken
+    // once for all new tasks and the expiry that follows them, so that the context thread locks
+    // it about once per wake-up. Only stop commands release it to complete their targets.
+    void drain_commands(std::unique_lock<std::mutex>& store_lock) noexcept {
+      while (command_type* op = command_queue_.pop_front()) {
+        if (!store_lock.owns_lock()) {
+          store_lock.lock();
         }
-        time_point now = std::chrono::steady_clock::now();
-        task_type* op = heap_.front();
-        while (op && op->time_point_ <= now) {
-          heap_.pop_front();
-          op->set_value_(op);
-          op = heap_.front();
+        if (op->command_ == command_type::command_type::schedule) {
+          insert(static_cast<task_type*>(op));
+        } else {
+          STDEXEC_ASSERT(op->command_ == command_type::command_type::stop);
+          stop_type* stop_op = static_cast<stop_type*>(op);
+          const bool erased = erase(stop_op->target_);
+          store_lock.unlock();
+          if (erased) {
+            stop_op->target_->set_stopped_(stop_op->target_);
+          }
+          stop_op->set_value_(stop_op);
         }
-        time_point deadline = op ? op->time_point_ : now + std::chrono::seconds(2);
+      }
+    }
+
+    void run() {
+      while (true) {
+        std::unique_lock store_lock{store_mutex_, std::defer_lock};
+        drain_commands(store_lock);
+        std::optional<time_point> wake_up = expire(std::chrono::steady_clock::now(), store_lock);
+        auto is_ready = [this] {
+          return ready_ || stop_requested_;
+        };
         std::unique_lock lock{ready_mutex_};
-        cv_.wait_until(lock, deadline, [this] { return ready_ || stop_requested_; });
+        // New commands and stop requests notify cv_, so there is nothing to wait for but them
+        // if no task is pending.
+        if (wake_up) {
+          cv_.wait_until(lock, *wake_up, is_ready);
+        } else {
+          cv_.wait(lock, is_ready);
+        }
         bool stop_requested = stop_requested_;
         ready_ = false;
         lock.unlock();
         if (stop_requested) {
           std::ptrdiff_t expected = 0;
           while (!n_submissions_in_flight_.compare_exchange_weak(
-            expected, context_closed, std::memory_order_relaxed)) {
+            expected, context_closed, std::memory_order_acquire, std::memory_order_relaxed)) {
             stdexec::__spin_loop_pause();
             expected = 0;
           }
-          op = heap_.front();
-          while (op) {
-            heap_.pop_front();
-            op->set_stopped_(op);
-            op = heap_.front();
-          }
+          // No command is pushed anymore, but the ones that arrived together with the stop
+          // request have not been taken yet. Their tasks are stopped together with the others.
+          std::unique_lock store_lock{store_mutex_, std::defer_lock};
+          drain_commands(store_lock);
+          stop_all(store_lock);
           break;
         }
       }
@@ -196,7 +421,8 @@ namespace exec {
         ready_ = true;
         cv_.notify_one();
       }
-      n_submissions_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      // Publishes the push to the context thread once it closes the context.
+      n_submissions_in_flight_.fetch_sub(1, std::memory_order_release);
     }
 
     void request_stop() {
@@ -206,9 +432,16 @@ namespace exec {
     }
 
     stdexec::__intrusive_mpsc_queue<&command_type::next_> command_queue_;
+    std::chrono::steady_clock::duration timer_slack_;
+    timed_thread_timer_store timer_store_;
     intrusive_heap<&task_type::when_, &task_type::prev_, &task_type::left_, &task_type::right_>
       heap_;
+    intrusive_dary_heap<&task_type::when_, &task_type::heap_index_> dary_heap_;
+    intrusive_timer_wheel<&task_type::latest_, &task_type::wheel_prev_, &task_type::wheel_next_>
+      wheel_;
     std::atomic<std::ptrdiff_t> n_submissions_in_flight_{0};
+    // Guards the timer stores, which other threads access to cancel timers.
+    std::mutex store_mutex_;
     std::mutex ready_mutex_;
     bool ready_{false};
     bool stop_requested_{false};
@@ -227,9 +460,11 @@ namespace exec {
       __t(
         timed_thread_context& context,
         std::chrono::steady_clock::time_point time_point,
+        std::chrono::steady_clock::duration slack,
         Receiver receiver) noexcept
         : _time_thrd_sched::timed_thread_schedule_operation_base{
           time_point,
+          slack,
           [](_time_thrd_sched::timed_thread_operation_base* op) noexcept {
             auto* self = static_cast<__t*>(op);
             int counter = self->ref_count_.fetch_sub(1, std::memory_order_relaxed);
@@ -291,7 +526,7 @@ namespace exec {
 
       void request_stop() noexcept {
         if (ref_count_.fetch_add(1, std::memory_order_relaxed) == 1) {
-          context_.schedule(&stop_op_);
+          context_.cancel(&stop_op_);
         }
       }
 
@@ -316,9 +551,11 @@ namespace exec {
 
       schedule_at(
         timed_thread_context& context,
-        std::chrono::steady_clock::time_point time_point) noexcept
+        std::chrono::steady_clock::time_point time_point,
+        std::chrono::steady_clock::duration slack = {}) noexcept
         : context_{&context}
-        , time_point_{time_point} {
+        , time_point_{time_point}
+        , slack_{slack} {
       }
 
       auto get_env() const noexcept {
@@ -330,7 +567,7 @@ namespace exec {
       template <class Receiver>
       auto connect(Receiver receiver) const & noexcept ->
         typename _time_thrd_sched::timed_thread_schedule_at_op<Receiver>::__t {
-        return {*context_, time_point_, std::move(receiver)};
+        return {*context_, time_point_, slack_, std::move(receiver)};
       }
 
      private:
@@ -338,10 +575,24 @@ namespace exec {
 
       timed_thread_context* context_;
       std::chrono::steady_clock::time_point time_point_;
+      std::chrono::steady_clock::duration slack_;
     };
 
-    explicit timed_thread_scheduler(timed_thread_context& context) noexcept
-      : context_{&context} {
+    explicit timed_thread_scheduler(timed_thread_context& context, duration slack = {}) noexcept
+      : context_{&context}
+      , slack_{slack} {
+    }
+
+    /// Returns a scheduler whose timers may complete up to slack later than their deadlines.
+    /// This overrides the timer slack of the context.
+    [[nodiscard]]
+    auto with_slack(duration slack) const noexcept -> timed_thread_scheduler {
+      return timed_thread_scheduler{*context_, slack};
+    }
+
+    [[nodiscard]]
+    auto slack() const noexcept -> duration {
+      return slack_;
     }
 
     STDEXEC_MEMFN_DECL(auto now)(this const timed_thread_scheduler&) noexcept -> time_point {
@@ -349,7 +600,7 @@ namespace exec {
     }
 
     STDEXEC_MEMFN_DECL(auto schedule_at)(this const timed_thread_scheduler& self, time_point tp) noexcept -> schedule_at {
-      return schedule_at{*self.context_, tp};
+      return schedule_at{*self.context_, tp, self.slack_};
     }
 
     auto schedule() const noexcept -> schedule_at {
@@ -360,9 +611,10 @@ namespace exec {
 
    private:
     timed_thread_context* context_;
+    duration slack_;
   };
 
   inline timed_thread_scheduler timed_thread_context::get_scheduler() noexcept {
-    return timed_thread_scheduler{*this};
+    return timed_thread_scheduler{*this, timer_slack_};
   }
 } // namespace exec
\ No newline at end of file
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "./timed_scheduler.hpp"
+#include "./when_any.hpp"
+
+#include <chrono>
+#include <system_error>
+
+namespace exec {
+  namespace __timeout {
+    using namespace stdexec;
+
+    // timeout(sndr, sched, duration) completes like sndr if it completes within the given
+    // duration, measured by a timer on sched. Otherwise sndr is stopped and the resulting sender
+    // completes with set_error(std::error_code) with std::errc::timed_out.
+    //
+    // If sndr wins, the timer is stopped through its stop token. How expensive that is depends
+    // on the scheduler; timed_thread_scheduler unlinks the timer on the calling thread.
+    struct timeout_t {
+      template <class _Sender, class _Scheduler, class _Rep, class _Period>
+        requires tag_invocable<
+          timeout_t,
+          _Sender,
+          _Scheduler,
+          std::chrono::duration<_Rep, _Period>>
+      auto operator()(
+        _Sender&& __sndr,
+        _Scheduler&& __sched,
+        std::chrono::duration<_Rep, _Period> __duration) const
+        noexcept(nothrow_tag_invocable<
+                 timeout_t,
+                 _Sender,
+                 _Scheduler,
+                 std::chrono::duration<_Rep, _Period>>)
+          -> tag_invoke_result_t<
+            timeout_t,
+            _Sender,
+            _Scheduler,
+            std::chrono::duration<_Rep, _Period>> {
+        return tag_invoke(
+          *this,
+          static_cast<_Sender&&>(__sndr),
+          static_cast<_Scheduler&&>(__sched),
+          __duration);
+      }
+
+      template <sender _Sender, timed_scheduler _Scheduler, class _Rep, class _Period>
+        requires(!tag_invocable<
+                 timeout_t,
+                 _Sender,
+                 _Scheduler,
+                 std::chrono::duration<_Rep, _Period>>)
+      auto operator()(
+        _Sender&& __sndr,
+        _Scheduler&& __sched,
+        std::chrono::duration<_Rep, _Period> __duration) const {
+        using __duration_t = duration_of_t<_Scheduler>;
+        return when_any(
+          static_cast<_Sender&&>(__sndr),
+          let_value(
+            schedule_after(
+              static_cast<_Scheduler&&>(__sched),
+              std::chrono::duration_cast<__duration_t>(__duration)),
+            [] { return just_error(std::make_error_code(std::errc::timed_out)); }));
+      }
+    };
+  } // namespace __timeout
+
+  using __timeout::timeout_t;
+  inline constexpr timeout_t timeout{};
+} // namespace exec
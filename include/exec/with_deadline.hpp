@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "../stdexec/execution.hpp"
+#include "./timed_scheduler.hpp"
+#include "./when_any.hpp"
+
+#include <chrono>
+
+namespace exec {
+  namespace __with_deadline {
+    using namespace stdexec;
+
+    template <class _Sender>
+    using __scheduler_of_t = //
+      __call_result_t<get_completion_scheduler_t<set_value_t>, env_of_t<_Sender>>;
+
+    template <class _Sender>
+    concept __has_timed_scheduler =                        //
+      sender<_Sender> &&                                   //
+      requires { typename __scheduler_of_t<_Sender>; } && //
+      timed_scheduler<__scheduler_of_t<_Sender>>;
+
+    // with_deadline(sndr, duration) completes like sndr if it completes within the given
+    // duration. Otherwise sndr is stopped and the resulting sender completes with set_stopped().
+    //
+    // Senders can customize this to enforce the deadline more efficiently. By default the sender
+    // races a timer on its own value completion scheduler.
+    struct with_deadline_t {
+      template <class _Sender, class _Rep, class _Period>
+        requires tag_invocable<with_deadline_t, _Sender, std::chrono::duration<_Rep, _Period>>
+      auto operator()(_Sender&& __sndr, std::chrono::duration<_Rep, _Period> __duration) const
+        noexcept(
+          nothrow_tag_invocable<with_deadline_t, _Sender, std::chrono::duration<_Rep, _Period>>)
+          -> tag_invoke_result_t<with_deadline_t, _Sender, std::chrono::duration<_Rep, _Period>> {
+        return tag_invoke(*this, static_cast<_Sender&&>(__sndr), __duration);
+      }
+
+      template <class _Sender, class _Rep, class _Period>
+        requires(!tag_invocable<with_deadline_t, _Sender, std::chrono::duration<_Rep, _Period>>)
+             && __has_timed_scheduler<_Sender>
+      auto
+        operator()(_Sender&& __sndr, std::chrono::duration<_Rep, _Period> __duration) const {
+        auto __sched = get_completion_scheduler<set_value_t>(get_env(__sndr));
+        using __duration_t = duration_of_t<decltype(__sched)>;
+        return when_any(
+          static_cast<_Sender&&>(__sndr),
+          let_value(
+            schedule_after(__sched, std::chrono::duration_cast<__duration_t>(__duration)),
+            [] { return just_stopped(); }));
+      }
+    };
+  } // namespace __with_deadline
+
+  using __with_deadline::with_deadline_t;
+  inline constexpr with_deadline_t with_deadline{};
+} // namespace exec
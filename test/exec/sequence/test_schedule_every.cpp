@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/sequence/schedule_every.hpp"
+
+#include "exec/sequence/ignore_all_values.hpp"
+#include "exec/sequence/transform_each.hpp"
+#include "exec/timed_thread_scheduler.hpp"
+#include "exec/variant_sender.hpp"
+#include "exec/when_any.hpp"
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+  using time_point = std::chrono::steady_clock::time_point;
+  using item_sender_t =
+    exec::variant_sender<decltype(stdexec::just()), decltype(stdexec::just_stopped())>;
+
+  // Records the time points of the ticks and stops the sequence after n_ticks ticks. Sleeps for
+  // busy_for in the first tick.
+  auto record_ticks(
+    exec::timed_thread_scheduler sched,
+    std::chrono::milliseconds period,
+    exec::missed_tick_policy policy,
+    std::size_t n_ticks,
+    std::chrono::milliseconds busy_for = 0ms) -> std::vector<time_point> {
+    std::vector<time_point> ticks;
+    int n_early = 0;
+    auto result = stdexec::sync_wait(exec::ignore_all_values(
+      exec::schedule_every(sched, period, policy)
+      | exec::transform_each(stdexec::let_value([&](time_point tick) -> item_sender_t {
+          n_early += std::chrono::steady_clock::now() < tick;
+          if (ticks.empty()) {
+            std::this_thread::sleep_for(busy_for);
+          }
+          ticks.push_back(tick);
+          if (ticks.size() == n_ticks) {
+            return stdexec::just_stopped();
+          }
+          return stdexec::just();
+        }))));
+    CHECK_FALSE(result);
+    CHECK(n_early == 0);
+    return ticks;
+  }
+
+  TEST_CASE("schedule_every - ticks do not drift", "[sequence_senders][schedule_every]") {
+    exec::timed_thread_context context;
+    auto ticks =
+      record_ticks(context.get_scheduler(), 5ms, exec::missed_tick_policy::skip, 10);
+    REQUIRE(ticks.size() == 10);
+    // A slow machine may skip ticks, but the remaining ones stay on the grid of the period.
+    for (std::size_t i = 1; i < ticks.size(); ++i) {
+      CHECK(ticks[i] > ticks[i - 1]);
+      CHECK((ticks[i] - ticks[0]) % 5ms == 0ms);
+    }
+  }
+
+  TEST_CASE("schedule_every - skip missed ticks", "[sequence_senders][schedule_every]") {
+    exec::timed_thread_context context;
+    auto ticks =
+      record_ticks(context.get_scheduler(), 10ms, exec::missed_tick_policy::skip, 2, 35ms);
+    REQUIRE(ticks.size() == 2);
+    auto gap = ticks[1] - ticks[0];
+    CHECK(gap >= 40ms);
+    CHECK(gap % 10ms == 0ms);
+  }
+
+  TEST_CASE("schedule_every - burst missed ticks", "[sequence_senders][schedule_every]") {
+    exec::timed_thread_context context;
+    auto ticks =
+      record_ticks(context.get_scheduler(), 10ms, exec::missed_tick_policy::burst, 5, 35ms);
+    REQUIRE(ticks.size() == 5);
+    for (std::size_t i = 1; i < ticks.size(); ++i) {
+      CHECK(ticks[i] - ticks[0] == 10ms * i);
+    }
+  }
+
+  TEST_CASE("schedule_every - stop a waiting sequence", "[sequence_senders][schedule_every]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler sched = context.get_scheduler();
+    int n_ticks = 0;
+    auto result = stdexec::sync_wait(exec::when_any(
+      exec::ignore_all_values(
+        exec::schedule_every(sched, std::chrono::hours(1))
+        | exec::transform_each(stdexec::then([&](time_point) { ++n_ticks; }))),
+      exec::schedule_after(sched, 10ms)
+        | stdexec::let_value([] { return stdexec::just_stopped(); })));
+    CHECK_FALSE(result);
+    CHECK(n_ticks == 0);
+  }
+} // namespace
@@ -26,6 +26,8 @@
 #  include "exec/single_thread_context.hpp"
 #  include "exec/finally.hpp"
 #  include "exec/when_any.hpp"
+#  include "exec/async_scope.hpp"
+#  include "exec/static_thread_pool.hpp"
 
 #  include "catch2/catch.hpp"
 
@@ -101,6 +103,221 @@ namespace {
     }
   }
 
+  TEST_CASE(
+    "io_uring_context - submission queue polling",
+    "[types][io_uring][schedulers][sq_poll]") {
+    io_uring_context context{io_uring_context_options{.sq_poll = true, .sq_thread_idle = 1ms}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      int n_called = 0;
+      for (int i = 0; i < 3; ++i) {
+        sync_wait(schedule_after(scheduler, 1ms) | then([&] {
+                    CHECK(io_thread.get_id() == std::this_thread::get_id());
+                    ++n_called;
+                  }));
+        // Let the polling thread go to sleep such that the next submission has to wake it up.
+        std::this_thread::sleep_for(5ms);
+      }
+      CHECK(n_called == 3);
+    }
+  }
+
+#  if defined(IORING_SETUP_SINGLE_ISSUER) && defined(IORING_SETUP_DEFER_TASKRUN)
+  TEST_CASE(
+    "io_uring_context - single issuer with deferred task running",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{
+      .coop_taskrun = true, .single_issuer = true, .defer_taskrun = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    // The ring is created on this thread but driven by another one.
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      bool is_called = false;
+      sync_wait(when_all(schedule(scheduler), schedule_after(scheduler, 1ms)) | then([&] {
+                  CHECK(io_thread.get_id() == std::this_thread::get_id());
+                  is_called = true;
+                }));
+      CHECK(is_called);
+    }
+  }
+#  endif
+
+  TEST_CASE(
+    "io_uring_context - reap completions in small batches",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.entries = 4, .completion_batch_size = 1}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    int n_called = 0;
+    for (int i = 0; i < 32; ++i) {
+      scope.spawn(schedule_after(scheduler, 100us) | then([&] { ++n_called; }));
+    }
+    sync_wait(when_all(scope.on_empty(), context.run(until::empty)));
+    CHECK(n_called == 32);
+  }
+
+  TEST_CASE("io_uring_context - collect statistics", "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.entries = 4, .collect_statistics = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    for (int i = 0; i < 16; ++i) {
+      scope.spawn(schedule_after(scheduler, 100us));
+    }
+    scope.spawn(exec::when_any(schedule_after(scheduler, 100us), schedule_after(scheduler, 10s)));
+    sync_wait(when_all(scope.on_empty(), context.run(until::empty)));
+    io_uring_statistics stats = context.statistics();
+    CHECK(stats.deferred_submissions > 0);
+#  if STDEXEC_ENABLE_IO_URING_STATISTICS
+    auto timeouts = std::find_if(stats.opcodes.begin(), stats.opcodes.end(), [](auto& op) {
+      return op.opcode == IORING_OP_TIMEOUT;
+    });
+    REQUIRE(timeouts != stats.opcodes.end());
+    CHECK(timeouts->submissions == 18);
+    CHECK(timeouts->completions == 18);
+    CHECK(timeouts->cancellations == 1);
+    CHECK(timeouts->errors == 0);
+    // Only 4 of the 18 timeouts fit into the submission queue at once.
+    CHECK(timeouts->deferrals >= 14);
+    CHECK(timeouts->deferrals <= 18);
+    CHECK(timeouts->latency.count() == 18);
+    CHECK(timeouts->latency.quantile(0.5) >= 64us);
+    CHECK(timeouts->handler_time.count() == 18);
+#  else
+    CHECK(stats.opcodes.empty());
+#  endif
+  }
+
+  TEST_CASE(
+    "io_uring_context - completion queue larger than the submission queue",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{
+      .entries = 8, .cq_entries = 64, .collect_statistics = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    int n_called = 0;
+    for (int i = 0; i < 100; ++i) {
+      scope.spawn(schedule_after(scheduler, 50ms) | then([&] { ++n_called; }));
+    }
+    std::ptrdiff_t load = 0;
+    scope.spawn(schedule_after(scheduler, 10ms) | then([&] { load = context.__load(); }));
+    sync_wait(when_all(scope.on_empty(), context.run(until::empty)));
+    CHECK(n_called == 100);
+    CHECK(load > 16);
+    CHECK(load <= 64);
+    io_uring_statistics stats = context.statistics();
+    CHECK(stats.deferred_submissions > 0);
+    CHECK(stats.pending_time > 0ns);
+  }
+
+#  ifdef IORING_FEAT_NODROP
+  TEST_CASE(
+    "io_uring_context - more operations in flight than completion queue entries",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{
+      .entries = 8, .cq_entries = 16, .max_in_flight = 1000, .collect_statistics = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    int n_called = 0;
+    for (int i = 0; i < 100; ++i) {
+      scope.spawn(schedule_after(scheduler, 50ms) | then([&] { ++n_called; }));
+    }
+    std::ptrdiff_t load = 0;
+    scope.spawn(schedule_after(scheduler, 10ms) | then([&] { load = context.__load(); }));
+    sync_wait(when_all(scope.on_empty(), context.run(until::empty)));
+    CHECK(n_called == 100);
+    CHECK(load > 16);
+    CHECK(context.statistics().dropped_completions == 0);
+  }
+#  endif
+
+  TEST_CASE("io_uring_context - no statistics by default", "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    sync_wait(when_all(schedule_after(context.get_scheduler(), 100us), context.run(until::empty)));
+    CHECK(context.statistics().opcodes.empty());
+  }
+
+  TEST_CASE("io_uring_latency_histogram - quantiles", "[types][io_uring]") {
+    io_uring_latency_histogram histogram{};
+    CHECK(histogram.quantile(0.5) == 0ns);
+    histogram.buckets[3] = 99; // [4ns, 8ns)
+    histogram.buckets[10] = 1; // [512ns, 1024ns)
+    CHECK(histogram.count() == 100);
+    CHECK(histogram.quantile(0.5) == 8ns);
+    CHECK(histogram.quantile(0.98) == 8ns);
+    CHECK(histogram.quantile(1.0) == 1024ns);
+  }
+
+  TEST_CASE(
+    "io_uring_context - busy poll before blocking",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.busy_poll = 1ms}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      int n_called = 0;
+      for (int i = 0; i < 3; ++i) {
+        // The first two submissions arrive while the driving thread spins, the last one after
+        // it has blocked.
+        std::this_thread::sleep_for(i == 2 ? 5ms : 100us);
+        sync_wait(when_all(schedule(scheduler), schedule_after(scheduler, 100us)) | then([&] {
+                    CHECK(io_thread.get_id() == std::this_thread::get_id());
+                    ++n_called;
+                  }));
+      }
+      CHECK(n_called == 3);
+    }
+  }
+
+  TEST_CASE(
+    "io_uring_context - poll for completions",
+    "[types][io_uring][schedulers][io_poll]") {
+    io_uring_context context{io_uring_context_options{.io_poll = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    {
+      scope_guard guard{[&]() noexcept {
+        context.request_stop();
+      }};
+      int n_called = 0;
+      for (int i = 0; i < 3; ++i) {
+        sync_wait(schedule(scheduler) | then([&] {
+                    CHECK(io_thread.get_id() == std::this_thread::get_id());
+                    ++n_called;
+                  }));
+      }
+      CHECK(n_called == 3);
+    }
+  }
+
+  TEST_CASE(
+    "io_uring_context - poll for completions until empty",
+    "[types][io_uring][schedulers][io_poll]") {
+    io_uring_context context{io_uring_context_options{.io_poll = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    bool is_called = false;
+    sync_wait(when_all(
+      schedule(scheduler) | then([&] { is_called = true; }), context.run(until::empty)));
+    CHECK(is_called);
+  }
+
   TEST_CASE(
     "io_uring_context Call io_uring::run_until_empty with start_detached",
     "[types][io_uring][schedulers]") {
@@ -339,6 +556,81 @@ namespace {
     }
   }
 
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 5, 0)
+  TEST_CASE("io_uring_context - coalesce timers", "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{
+      .collect_statistics = true, .coalesce_timers = true, .timer_slack = 1ms}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    int n_called = 0;
+    int n_early = 0;
+    for (int i = 0; i < 1000; ++i) {
+      auto duration = 10ms + (i % 10) * 100us;
+      auto deadline = std::chrono::steady_clock::now() + duration;
+      scope.spawn(schedule_after(scheduler, duration) | then([&, deadline] {
+                    n_early += std::chrono::steady_clock::now() < deadline;
+                    ++n_called;
+                  }));
+    }
+    sync_wait(when_all(scope.on_empty(), context.run(until::empty)));
+    CHECK(n_called == 1000);
+    CHECK(n_early == 0);
+#    if STDEXEC_ENABLE_IO_URING_STATISTICS
+    io_uring_statistics stats = context.statistics();
+    auto timeouts = std::find_if(stats.opcodes.begin(), stats.opcodes.end(), [](auto& op) {
+      return op.opcode == IORING_OP_TIMEOUT;
+    });
+    REQUIRE(timeouts != stats.opcodes.end());
+    CHECK(timeouts->submissions < 10);
+#    endif
+  }
+
+  TEST_CASE("io_uring_context - coalesced timers fire in order", "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.coalesce_timers = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    std::vector<int> order;
+    auto timer = [&](int id, std::chrono::milliseconds duration) {
+      return schedule_after(scheduler, duration) | then([&order, id] { order.push_back(id); });
+    };
+    sync_wait(when_all(
+      when_all(timer(0, 30ms), timer(1, 10ms), timer(2, 20ms)), context.run(until::empty)));
+    CHECK(order == std::vector<int>{1, 2, 0});
+  }
+
+  TEST_CASE("io_uring_context - stop a coalesced timer", "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.coalesce_timers = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    bool is_called = false;
+    auto start = std::chrono::steady_clock::now();
+    // The cancelled timer must not keep the context busy until its deadline.
+    sync_wait(when_all(
+      when_any(
+        schedule_after(scheduler, 10s) | then([&] { is_called = true; }),
+        schedule_after(scheduler, 10ms)),
+      context.run(until::empty)));
+    CHECK_FALSE(is_called);
+    CHECK(std::chrono::steady_clock::now() - start < 5s);
+  }
+
+  TEST_CASE(
+    "io_uring_context - stopping the context stops coalesced timers",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context{io_uring_context_options{.coalesce_timers = true}};
+    io_uring_scheduler scheduler = context.get_scheduler();
+    jthread io_thread{[&] {
+      context.run_until_stopped();
+    }};
+    single_thread_context ctx1{};
+    auto result = sync_wait(when_all(
+      schedule_after(scheduler, 10s),
+      schedule(ctx1.get_scheduler()) | then([&] {
+        std::this_thread::sleep_for(10ms);
+        context.request_stop();
+      })));
+    CHECK_FALSE(result);
+  }
+#  endif
+
   TEST_CASE("io_uring_context - reuse context after being used", "[types][io_uring][schedulers]") {
     io_uring_context context;
     io_uring_scheduler scheduler = context.get_scheduler();
@@ -348,6 +640,44 @@ namespace {
     CHECK(sync_wait(exec::when_any(schedule(scheduler), context.run())));
     CHECK(!sync_wait(exec::when_any(schedule(scheduler), context.run())));
   }
+
+  TEST_CASE(
+    "io_uring_context - batch continuations to a thread pool",
+    "[types][io_uring][schedulers]") {
+    io_uring_context context;
+    static_thread_pool pool{2};
+    context.set_continuation_batch(pool);
+    exec::single_thread_context io_thread;
+    std::atomic<int> n_completed{0};
+    std::atomic<int> n_continued{0};
+    std::atomic<int> n_continued_early{0};
+    {
+      // The tasks are all ready when the context starts to run, so the first pass completes
+      // all of them. Each completion gives the pool time to pick up continuations that have
+      // been handed over early.
+      exec::async_scope work;
+      for (int i = 0; i < 16; ++i) {
+        work.spawn(
+          schedule(context.get_scheduler()) | then([&] {
+            ++n_completed;
+            std::this_thread::sleep_for(1ms);
+          })
+          | continue_on(pool.get_scheduler()) | then([&] {
+              if (n_completed != 16) {
+                ++n_continued_early;
+              }
+              ++n_continued;
+            }));
+      }
+      exec::async_scope scope;
+      scope.spawn(stdexec::on(io_thread.get_scheduler(), context.run(until::stopped)));
+      sync_wait(work.on_empty());
+      context.request_stop();
+      sync_wait(scope.on_empty());
+    }
+    CHECK(n_continued == 16);
+    CHECK(n_continued_early == 0);
+  }
 } // namespace
 
 #endif
@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_operations.hpp"
+#  include "exec/single_thread_context.hpp"
+#  include "exec/when_any.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <array>
+#  include <cstdio>
+#  include <atomic>
+#  include <cerrno>
+#  include <cstring>
+#  include <filesystem>
+#  include <span>
+#  include <string>
+#  include <utility>
+
+#  include <arpa/inet.h>
+#  include <fcntl.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+using namespace stdexec;
+using namespace exec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  // An io_uring_context that is driven by a background thread.
+  struct io_thread {
+    io_uring_context context{};
+    std::thread thread{[this] { context.run_until_stopped(); }};
+
+    ~io_thread() {
+      context.request_stop();
+      thread.join();
+    }
+  };
+
+  // A temporary file that is removed on destruction.
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-io-XXXXXX"};
+    int fd = ::mkstemp(path.data());
+
+    ~temp_file() {
+      ::close(fd);
+      ::unlink(path.data());
+    }
+  };
+
+  // A connected pair of tcp sockets on the loopback interface.
+  struct tcp_pair {
+    int client = -1;
+    int server = -1;
+
+    tcp_pair() {
+      int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+      ::sockaddr_in address{};
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      ::socklen_t length = sizeof(address);
+      ::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+      ::listen(listener, 1);
+      ::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length);
+      client = ::socket(AF_INET, SOCK_STREAM, 0);
+      ::connect(client, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+      server = ::accept(listener, nullptr, nullptr);
+      ::close(listener);
+    }
+
+    ~tcp_pair() {
+      ::close(client);
+      ::close(server);
+    }
+  };
+
+  auto as_bytes(const char* text) -> std::span<const std::byte> {
+    return std::as_bytes(std::span{text, std::strlen(text)});
+  }
+
+  TEST_CASE("io_uring_operations - write and read a file", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    REQUIRE(file.fd >= 0);
+    io_uring_scheduler sched = io.context.get_scheduler();
+
+    auto written = sync_wait(io_uring_write(sched, file.fd, as_bytes("hello world")));
+    REQUIRE(written);
+    CHECK(std::get<0>(*written) == 11);
+
+    std::array<std::byte, 5> buffer{};
+    auto read = sync_wait(io_uring_read(sched, file.fd, buffer, 6));
+    REQUIRE(read);
+    CHECK(std::get<0>(*read) == 5);
+    CHECK(std::memcmp(buffer.data(), "world", 5) == 0);
+  }
+
+  TEST_CASE("io_uring_operations - errors complete with system_error", "[io_uring][operations]") {
+    io_thread io;
+    std::array<std::byte, 8> buffer{};
+    CHECK_THROWS_AS(
+      sync_wait(io_uring_read(io.context.get_scheduler(), -1, buffer)), std::system_error);
+  }
+
+  TEST_CASE("io_uring_link - write then fsync then read", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    std::array<std::byte, 3> buffer{};
+    auto result = sync_wait(io_uring_link(
+      io_uring_write(sched, file.fd, as_bytes("abcdef")),
+      io_uring_fsync(sched, file.fd, true),
+      io_uring_read(sched, file.fd, buffer, 3)));
+    REQUIRE(result);
+    auto [n_written, n_read] = *result;
+    CHECK(n_written == 6);
+    CHECK(n_read == 3);
+    CHECK(std::memcmp(buffer.data(), "def", 3) == 0);
+  }
+
+  TEST_CASE("io_uring_link - the first failing stage fails the chain", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    std::array<std::byte, 3> buffer{};
+    try {
+      sync_wait(io_uring_link(
+        io_uring_write(sched, -1, as_bytes("abc")), io_uring_read(sched, file.fd, buffer)));
+      FAIL("expected an error");
+    } catch (const std::system_error& error) {
+      CHECK(error.code() == std::errc::bad_file_descriptor);
+    }
+  }
+
+  TEST_CASE("io_uring_link - a linked timeout fails a slow stage", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    int pipe_fds[2];
+    REQUIRE(::pipe(pipe_fds) == 0);
+    std::array<std::byte, 1> buffer{};
+    try {
+      sync_wait(io_uring_link(
+        io_uring_read(sched, pipe_fds[0], buffer), io_uring_link_timeout(10ms)));
+      FAIL("expected an error");
+    } catch (const std::system_error& error) {
+      CHECK(error.code() == std::errc::timed_out);
+    }
+    // A stage that completes in time does not fail.
+    REQUIRE(::write(pipe_fds[1], "x", 1) == 1);
+    auto result = sync_wait(
+      io_uring_link(io_uring_read(sched, pipe_fds[0], buffer), io_uring_link_timeout(10s)));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 1);
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+  }
+
+  TEST_CASE("io_uring_link - stop a pending chain", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    int pipe_fds[2];
+    REQUIRE(::pipe(pipe_fds) == 0);
+    std::array<std::byte, 1> buffer{};
+    auto result = sync_wait(when_any(
+      io_uring_link(
+        io_uring_read(sched, pipe_fds[0], buffer), io_uring_read(sched, pipe_fds[0], buffer))
+        | then([](auto...) { return false; }),
+      schedule_after(sched, 10ms) | then([] { return true; })));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result));
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+  }
+
+  TEST_CASE("io_uring_link - a short stage fails the chain", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    REQUIRE(sync_wait(io_uring_write(sched, file.fd, as_bytes("abc"))));
+    std::array<std::byte, 8> buffer{};
+    try {
+      sync_wait(io_uring_link(
+        io_uring_read(sched, file.fd, buffer), io_uring_write(sched, file.fd, as_bytes("def"))));
+      FAIL("expected an error");
+    } catch (const io_uring_short_transfer& error) {
+      CHECK(error.code() == std::errc::io_error);
+      CHECK(error.stage() == 0);
+    }
+    // The link timeout between the stages is not the short stage.
+    try {
+      sync_wait(io_uring_link(
+        io_uring_fsync(sched, file.fd),
+        io_uring_read(sched, file.fd, buffer),
+        io_uring_link_timeout(10s),
+        io_uring_write(sched, file.fd, as_bytes("def"))));
+      FAIL("expected an error");
+    } catch (const io_uring_short_transfer& error) {
+      CHECK(error.stage() == 1);
+    }
+  }
+
+  template <class... Stages>
+  concept linkable = requires(Stages&&... stages) {
+    io_uring_link(static_cast<Stages&&>(stages)...);
+  };
+
+  using read_sender_t = decltype(io_uring_read(
+    std::declval<io_uring_scheduler>(),
+    0,
+    std::declval<std::span<std::byte>>()));
+  using link_timeout_t = decltype(io_uring_link_timeout(1s));
+
+  static_assert(linkable<read_sender_t, link_timeout_t>);
+  static_assert(linkable<read_sender_t, link_timeout_t, read_sender_t, link_timeout_t>);
+  static_assert(!linkable<link_timeout_t, read_sender_t>);
+  static_assert(!linkable<read_sender_t, link_timeout_t, link_timeout_t>);
+  static_assert(!linkable<read_sender_t, link_timeout_t, link_timeout_t, read_sender_t>);
+
+  TEST_CASE("with_deadline - io sender misses its deadline", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    int pipe_fds[2];
+    REQUIRE(::pipe(pipe_fds) == 0);
+    std::array<std::byte, 1> buffer{};
+    auto deadline = with_deadline(io_uring_read(sched, pipe_fds[0], buffer), 10ms);
+    using link_sender_t =
+      __io_uring::__link_sender<true, __io_uring::__read_operation, __io_uring::__link_timeout>;
+    STATIC_REQUIRE(std::same_as<decltype(deadline), link_sender_t>);
+    CHECK_FALSE(sync_wait(std::move(deadline)));
+    REQUIRE(::write(pipe_fds[1], "x", 1) == 1);
+    auto result = sync_wait(with_deadline(io_uring_read(sched, pipe_fds[0], buffer), 10s));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 1);
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+  }
+
+  TEST_CASE("with_deadline - other senders race a timer", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    CHECK_FALSE(sync_wait(with_deadline(schedule_after(sched, 10s), 10ms)));
+    CHECK(sync_wait(with_deadline(schedule(sched) | then([] { return 42; }), 10s)));
+  }
+
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+  TEST_CASE("io_uring_send_zc - completes after the buffer is released", "[io_uring][operations]") {
+    io_thread io;
+    tcp_pair sockets;
+    REQUIRE(sockets.server >= 0);
+    std::vector<std::byte> buffer(1 << 20);
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+      buffer[i] = static_cast<std::byte>(i % 251);
+    }
+    std::vector<std::byte> received(buffer.size());
+    std::thread reader{[&] {
+      std::size_t n_received = 0;
+      while (n_received < received.size()) {
+        ssize_t n = ::read(
+          sockets.server, received.data() + n_received, received.size() - n_received);
+        if (n <= 0) {
+          break;
+        }
+        n_received += static_cast<std::size_t>(n);
+      }
+    }};
+    std::size_t n_sent = 0;
+    while (n_sent < buffer.size()) {
+      auto result = sync_wait(io_uring_send_zc(
+        io.context.get_scheduler(), sockets.client, std::span{buffer}.subspan(n_sent)));
+      REQUIRE(result);
+      REQUIRE(std::get<0>(*result) > 0);
+      n_sent += std::get<0>(*result);
+    }
+    reader.join();
+    CHECK(n_sent == buffer.size());
+    CHECK(received == buffer);
+  }
+#  endif
+
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 8, 0)
+  TEST_CASE("io_uring_splice - move a file through pipes", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    REQUIRE(::write(file.fd, "hello world", 11) == 11);
+    std::array<int, 2> first{};
+    std::array<int, 2> second{};
+    REQUIRE(::pipe(first.data()) == 0);
+    REQUIRE(::pipe(second.data()) == 0);
+    io_uring_scheduler sched = io.context.get_scheduler();
+
+    auto spliced = sync_wait(io_uring_splice(sched, file.fd, 6, first[1], -1, 64));
+    REQUIRE(spliced);
+    CHECK(std::get<0>(*spliced) == 5);
+    auto duplicated = sync_wait(io_uring_tee(sched, first[0], second[1], 64));
+    REQUIRE(duplicated);
+    CHECK(std::get<0>(*duplicated) == 5);
+
+    std::array<char, 8> buffer{};
+    CHECK(::read(first[0], buffer.data(), buffer.size()) == 5);
+    CHECK(std::memcmp(buffer.data(), "world", 5) == 0);
+    CHECK(::read(second[0], buffer.data(), buffer.size()) == 5);
+    CHECK(std::memcmp(buffer.data(), "world", 5) == 0);
+    for (int fd: {first[0], first[1], second[0], second[1]}) {
+      ::close(fd);
+    }
+  }
+#  endif
+
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+  TEST_CASE("io_uring_operations - manage a file without blocking", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    std::string path = "/tmp/stdexec-io-" + std::to_string(::getpid());
+    std::string renamed = path + "-renamed";
+
+    auto opened = sync_wait(io_uring_open(sched, path, O_CREAT | O_EXCL | O_RDWR, 0600));
+    REQUIRE(opened);
+    safe_file_descriptor fd = std::move(std::get<0>(*opened));
+    REQUIRE(fd);
+
+    REQUIRE(sync_wait(io_uring_write(sched, fd, as_bytes("hello world"))));
+    REQUIRE(sync_wait(io_uring_fsync(sched, fd, true)));
+    REQUIRE(sync_wait(io_uring_fallocate(sched, fd, 0, 4096)));
+
+    auto status = sync_wait(io_uring_statx(sched, fd));
+    REQUIRE(status);
+    CHECK(std::get<0>(*status).stx_size == 4096);
+
+    REQUIRE(sync_wait(io_uring_rename(sched, path, renamed)));
+    auto renamed_status = sync_wait(io_uring_statx(sched, renamed, STATX_SIZE));
+    REQUIRE(renamed_status);
+    CHECK(std::get<0>(*renamed_status).stx_size == 4096);
+    CHECK_THROWS_AS(sync_wait(io_uring_statx(sched, path)), std::system_error);
+
+    REQUIRE(sync_wait(io_uring_unlink(sched, renamed)));
+    CHECK(::access(renamed.c_str(), F_OK) != 0);
+
+    const int raw_fd = fd.native_handle();
+    REQUIRE(sync_wait(io_uring_close(sched, std::move(fd))));
+    errno = 0;
+    CHECK(::fcntl(raw_fd, F_GETFD) == -1);
+    CHECK(errno == EBADF);
+  }
+
+  TEST_CASE("io_uring_link - move-only stages are moved into the chain", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    safe_file_descriptor fd{::dup(file.fd)};
+    const int raw_fd = fd.native_handle();
+    REQUIRE(raw_fd >= 0);
+    auto chain = io_uring_link(
+      io_uring_write(sched, raw_fd, as_bytes("abc")), io_uring_close(sched, std::move(fd)));
+    auto result = sync_wait(std::move(chain));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 3);
+    errno = 0;
+    CHECK(::fcntl(raw_fd, F_GETFD) == -1);
+    CHECK(errno == EBADF);
+  }
+
+  // Completes an operation whose receiver has been stopped before the operation starts.
+  struct stopped_receiver {
+    using receiver_concept = stdexec::receiver_t;
+    std::atomic<bool>* done;
+    inplace_stop_token token;
+
+    void set_value(auto&&...) noexcept {
+      done->store(true);
+    }
+
+    void set_error(std::exception_ptr) noexcept {
+      done->store(true);
+    }
+
+    void set_stopped() noexcept {
+      done->store(true);
+    }
+
+    auto get_env() const noexcept -> prop<get_stop_token_t, inplace_stop_token> {
+      return prop{get_stop_token, token};
+    }
+  };
+
+  template <class Sender>
+  void run_stopped(Sender&& sender, auto&& after_completion) {
+    std::atomic<bool> done{false};
+    inplace_stop_source stop_source;
+    stop_source.request_stop();
+    auto op = stdexec::connect(
+      static_cast<Sender&&>(sender), stopped_receiver{&done, stop_source.get_token()});
+    stdexec::start(op);
+    while (!done.load()) {
+      std::this_thread::yield();
+    }
+    after_completion();
+  }
+
+  auto count_open_files() -> std::size_t {
+    std::size_t count = 0;
+    for ([[maybe_unused]] auto& entry: std::filesystem::directory_iterator{"/proc/self/fd"}) {
+      ++count;
+    }
+    return count;
+  }
+
+  TEST_CASE("io_uring_close - a stopped close closes the file once", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    temp_file file;
+    safe_file_descriptor fd{::dup(file.fd)};
+    const int raw_fd = fd.native_handle();
+    REQUIRE(raw_fd >= 0);
+    int other_fd = -1;
+    run_stopped(io_uring_close(sched, std::move(fd)), [&] {
+      // The kernel closes the file unless the stop request canceled the close in time. If it has
+      // been closed, the operation must not close the number again once it is reused.
+      if (::fcntl(raw_fd, F_GETFD) == -1) {
+        other_fd = ::dup2(file.fd, raw_fd);
+        REQUIRE(other_fd == raw_fd);
+      }
+    });
+    if (other_fd == -1) {
+      errno = 0;
+      CHECK(::fcntl(raw_fd, F_GETFD) == -1);
+      CHECK(errno == EBADF);
+    } else {
+      CHECK(::fcntl(raw_fd, F_GETFD) != -1);
+      ::close(other_fd);
+    }
+  }
+
+  TEST_CASE("io_uring_open - a stopped open does not leak the file", "[io_uring][operations]") {
+    io_thread io;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    temp_file file;
+    const std::size_t n_open_files = count_open_files();
+    run_stopped(io_uring_open(sched, file.path.data(), O_RDONLY), [] {});
+    CHECK(count_open_files() == n_open_files);
+  }
+#  endif
+} // namespace
+
+#endif
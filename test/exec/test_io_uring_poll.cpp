@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 13, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_poll.hpp"
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
+#  include "exec/variant_sender.hpp"
+#  include "exec/when_any.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <array>
+#  include <atomic>
+#  include <thread>
+
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <unistd.h>
+
+using namespace stdexec;
+using namespace exec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  // An io_uring_context that is driven by a background thread.
+  struct io_thread {
+    io_uring_context context{};
+    std::thread thread{[this] { context.run_until_stopped(); }};
+
+    ~io_thread() {
+      context.request_stop();
+      thread.join();
+    }
+  };
+
+  struct pipe_pair {
+    std::array<int, 2> fds{-1, -1};
+
+    pipe_pair() {
+      REQUIRE(::pipe2(fds.data(), O_CLOEXEC) == 0);
+    }
+
+    ~pipe_pair() {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+  };
+
+  TEST_CASE("io_uring_poll - completes once the fd is ready", "[io_uring][operations]") {
+    io_thread io;
+    pipe_pair pipe;
+    std::thread writer{[&] {
+      std::this_thread::sleep_for(10ms);
+      REQUIRE(::write(pipe.fds[1], "x", 1) == 1);
+    }};
+    auto result = sync_wait(io_uring_poll(io.context.get_scheduler(), pipe.fds[0], POLLIN));
+    writer.join();
+    REQUIRE(result);
+    CHECK((std::get<0>(*result) & POLLIN) != 0);
+  }
+
+  TEST_CASE("io_uring_poll - stop a pending poll", "[io_uring][operations]") {
+    io_thread io;
+    pipe_pair pipe;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    auto result = sync_wait(when_any(
+      io_uring_poll(sched, pipe.fds[0], POLLIN),
+      schedule_after(sched, 10ms) | let_value([] { return just_stopped(); })));
+    CHECK_FALSE(result);
+  }
+
+  TEST_CASE(
+    "io_uring_poll_multishot - yields an item per readiness",
+    "[io_uring][operations][sequence]") {
+    io_thread io;
+    pipe_pair pipe;
+    std::atomic<int> n_items{0};
+    std::thread writer{[&] {
+      for (int i = 0; i < 3; ++i) {
+        // Wait for the previous byte to be consumed.
+        while (n_items.load() < i) {
+          std::this_thread::sleep_for(1ms);
+        }
+        REQUIRE(::write(pipe.fds[1], "x", 1) == 1);
+      }
+    }};
+    using item_sender_t = variant_sender<decltype(just()), decltype(just_stopped())>;
+    auto result = sync_wait(ignore_all_values(
+      io_uring_poll_multishot(io.context.get_scheduler(), pipe.fds[0], POLLIN)
+      | transform_each(let_value([&](unsigned revents) -> item_sender_t {
+          CHECK((revents & POLLIN) != 0);
+          char byte{};
+          CHECK(::read(pipe.fds[0], &byte, 1) == 1);
+          // The item that completes with set_stopped() ends the sequence, which then
+          // completes with set_stopped() as well.
+          if (n_items.fetch_add(1) + 1 == 3) {
+            return just_stopped();
+          }
+          return just();
+        }))));
+    writer.join();
+    CHECK_FALSE(result);
+    CHECK(n_items.load() == 3);
+  }
+
+  TEST_CASE(
+    "io_uring_poll_multishot - stop an idle sequence",
+    "[io_uring][operations][sequence]") {
+    io_thread io;
+    pipe_pair pipe;
+    io_uring_scheduler sched = io.context.get_scheduler();
+    int n_items = 0;
+    auto result = sync_wait(when_any(
+      ignore_all_values(
+        io_uring_poll_multishot(sched, pipe.fds[0], POLLIN)
+        | transform_each(then([&](unsigned) { ++n_items; }))),
+      schedule_after(sched, 10ms) | let_value([] { return just_stopped(); })));
+    CHECK_FALSE(result);
+    CHECK(n_items == 0);
+  }
+
+  TEST_CASE(
+    "io_uring_poll_multishot - stopping the context stops the sequence",
+    "[io_uring][operations][sequence]") {
+    io_thread io;
+    pipe_pair pipe;
+    std::thread stopper{[&] {
+      std::this_thread::sleep_for(10ms);
+      io.context.request_stop();
+    }};
+    int n_items = 0;
+    auto result = sync_wait(ignore_all_values(
+      io_uring_poll_multishot(io.context.get_scheduler(), pipe.fds[0], POLLIN)
+      | transform_each(then([&](unsigned) { ++n_items; }))));
+    stopper.join();
+    CHECK_FALSE(result);
+    CHECK(n_items == 0);
+  }
+
+  TEST_CASE("io_uring_poll_multishot - reports errors", "[io_uring][operations][sequence]") {
+    io_thread io;
+    CHECK_THROWS_AS(
+      sync_wait(
+        ignore_all_values(io_uring_poll_multishot(io.context.get_scheduler(), -1, POLLIN))),
+      std::system_error);
+  }
+} // namespace
+
+#endif
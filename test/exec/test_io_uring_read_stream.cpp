@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_read_stream.hpp"
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
+#  include "exec/static_thread_pool.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <array>
+#  include <atomic>
+#  include <chrono>
+#  include <cstring>
+#  include <thread>
+#  include <vector>
+
+#  include <fcntl.h>
+#  include <unistd.h>
+
+using namespace stdexec;
+using namespace exec;
+
+namespace {
+
+  // An io_uring_context that is driven by a background thread.
+  struct io_thread {
+    io_uring_context context{};
+    std::thread thread{[this] { context.run_until_stopped(); }};
+
+    ~io_thread() {
+      context.request_stop();
+      thread.join();
+    }
+  };
+
+  // A temporary file with the given contents that is removed on destruction.
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-stream-XXXXXX"};
+    int fd = ::mkstemp(path.data());
+
+    explicit temp_file(const std::vector<std::byte>& contents) {
+      REQUIRE(fd >= 0);
+      REQUIRE(::write(fd, contents.data(), contents.size()) == ssize_t(contents.size()));
+    }
+
+    ~temp_file() {
+      ::close(fd);
+      ::unlink(path.data());
+    }
+  };
+
+  auto make_contents(std::size_t size) -> std::vector<std::byte> {
+    std::vector<std::byte> contents(size);
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<std::byte>(i % 251);
+    }
+    return contents;
+  }
+
+  TEST_CASE("io_uring_read_stream - yields the file in order", "[types][io_uring][sequence]") {
+    io_thread io{};
+    std::vector<std::byte> contents = make_contents(100'000);
+    temp_file file{contents};
+    std::vector<std::byte> result;
+    std::size_t n_chunks = 0;
+    sync_wait(ignore_all_values(
+      io_uring_read_stream(io.context.get_scheduler(), file.fd, 4096, 4)
+      | transform_each(then([&](std::span<const std::byte> chunk) {
+          ++n_chunks;
+          result.insert(result.end(), chunk.begin(), chunk.end());
+        }))));
+    CHECK(n_chunks == (contents.size() + 4095) / 4096);
+    REQUIRE(result.size() == contents.size());
+    CHECK(std::memcmp(result.data(), contents.data(), contents.size()) == 0);
+  }
+
+  TEST_CASE("io_uring_read_stream - empty file", "[types][io_uring][sequence]") {
+    io_thread io{};
+    temp_file file{{}};
+    std::size_t n_chunks = 0;
+    auto result = sync_wait(ignore_all_values(
+      io_uring_read_stream(io.context.get_scheduler(), file.fd, 4096)
+      | transform_each(then([&](std::span<const std::byte>) { ++n_chunks; }))));
+    CHECK(result.has_value());
+    CHECK(n_chunks == 0);
+  }
+
+  TEST_CASE("io_uring_read_stream - reports errors", "[types][io_uring][sequence]") {
+    io_thread io{};
+    CHECK_THROWS_AS(
+      sync_wait(ignore_all_values(io_uring_read_stream(io.context.get_scheduler(), -1, 4096))),
+      std::system_error);
+  }
+
+  TEST_CASE(
+    "io_uring_read_stream - bounds the buffers in flight",
+    "[types][io_uring][sequence]") {
+    io_thread io{};
+    static_thread_pool pool{4};
+    std::vector<std::byte> contents = make_contents(1 << 20);
+    temp_file file{contents};
+    constexpr std::size_t n_buffers = 3;
+    std::atomic<std::size_t> in_use{0};
+    std::atomic<std::size_t> max_in_use{0};
+    std::atomic<std::size_t> checksum{0};
+    std::vector<const std::byte*> buffers;
+    sync_wait(ignore_all_values(
+      io_uring_read_stream(io.context.get_scheduler(), file.fd, 16 * 1024, n_buffers)
+      | transform_each(
+        then([&](std::span<const std::byte> chunk) {
+          buffers.push_back(chunk.data());
+          std::size_t n = in_use.fetch_add(1) + 1;
+          std::size_t max = max_in_use.load();
+          while (n > max && !max_in_use.compare_exchange_weak(max, n)) {
+          }
+          return chunk;
+        })
+        | continue_on(pool.get_scheduler()) | then([&](std::span<const std::byte> chunk) {
+            std::size_t sum = 0;
+            for (std::byte b: chunk) {
+              sum += static_cast<std::size_t>(b);
+            }
+            checksum.fetch_add(sum);
+            in_use.fetch_sub(1);
+          }))));
+    std::size_t expected = 0;
+    for (std::byte b: contents) {
+      expected += static_cast<std::size_t>(b);
+    }
+    CHECK(checksum.load() == expected);
+    CHECK(max_in_use.load() <= n_buffers);
+    std::sort(buffers.begin(), buffers.end());
+    buffers.erase(std::unique(buffers.begin(), buffers.end()), buffers.end());
+    CHECK(buffers.size() <= n_buffers);
+  }
+
+  TEST_CASE(
+    "io_uring_read_stream - stopping the context stops the stream",
+    "[types][io_uring][sequence]") {
+    io_thread io{};
+    static_thread_pool pool{2};
+    std::vector<std::byte> contents = make_contents(1 << 20);
+    temp_file file{contents};
+    std::atomic<std::size_t> n_chunks{0};
+    auto result = sync_wait(ignore_all_values(
+      io_uring_read_stream(io.context.get_scheduler(), file.fd, 4096, 4)
+      | transform_each(
+        continue_on(pool.get_scheduler()) | then([&](std::span<const std::byte>) {
+          if (n_chunks.fetch_add(1) == 0) {
+            io.context.request_stop();
+            // Let the context close, so that the next reads are issued to a closed context.
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          }
+        }))));
+    // The stream did not reach the end of the file, which must not look like success.
+    CHECK_FALSE(result.has_value());
+    CHECK(n_chunks.load() < contents.size() / 4096);
+  }
+} // namespace
+
+#endif
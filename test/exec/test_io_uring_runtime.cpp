@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_runtime.hpp"
+#  include "exec/async_scope.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <chrono>
+#  include <set>
+#  include <thread>
+#  include <vector>
+
+#  include <sched.h>
+
+using namespace stdexec;
+using namespace exec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  TEST_CASE("io_uring_runtime - schedule runs on the thread of the ring", "[io_uring][runtime]") {
+    io_uring_runtime runtime{2};
+    REQUIRE(runtime.size() == 2);
+    auto id0 = sync_wait(schedule(runtime.get_scheduler(0)) | then([] {
+                           return std::this_thread::get_id();
+                         }));
+    auto id1 = sync_wait(schedule(runtime.get_scheduler(1)) | then([] {
+                           return std::this_thread::get_id();
+                         }));
+    REQUIRE(id0);
+    REQUIRE(id1);
+    CHECK(std::get<0>(*id0) != std::this_thread::get_id());
+    CHECK(std::get<0>(*id1) != std::this_thread::get_id());
+    CHECK(std::get<0>(*id0) != std::get<0>(*id1));
+  }
+
+  TEST_CASE("io_uring_runtime - one ring per allowed cpu", "[io_uring][runtime]") {
+    ::cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    REQUIRE(::sched_getaffinity(0, sizeof(affinity), &affinity) == 0);
+    const auto n_cpus = static_cast<std::size_t>(CPU_COUNT(&affinity));
+    std::vector<int> cpus = __io_uring::__allowed_cpus();
+    CHECK(cpus.size() == n_cpus);
+    for (int cpu: cpus) {
+      CHECK(CPU_ISSET(cpu, &affinity));
+    }
+
+    io_uring_runtime runtime{};
+    CHECK(runtime.size() == n_cpus);
+    auto on_ring = sync_wait(schedule(runtime.get_scheduler(0)) | then([] { return true; }));
+    REQUIRE(on_ring);
+    CHECK(std::get<0>(*on_ring));
+  }
+
+  TEST_CASE("io_uring_runtime - hop between rings", "[io_uring][runtime]") {
+    io_uring_runtime runtime{4};
+    std::set<std::thread::id> threads;
+    std::size_t hops = 0;
+    auto hop = [&](std::size_t index) {
+      return continue_on(just(), runtime.get_scheduler(index)) | then([&] {
+               threads.insert(std::this_thread::get_id());
+               ++hops;
+             });
+    };
+    for (int round = 0; round < 100; ++round) {
+      sync_wait(
+        schedule(runtime.get_scheduler(0)) //
+        | let_value([&] { return hop(1); }) //
+        | let_value([&] { return hop(2); }) //
+        | let_value([&] { return hop(3); }) //
+        | let_value([&] { return hop(0); }));
+    }
+    CHECK(hops == 400);
+    CHECK(threads.size() == 4);
+  }
+
+  TEST_CASE("io_uring_runtime - timers on all rings", "[io_uring][runtime]") {
+    io_uring_runtime runtime{3};
+    exec::async_scope scope;
+    std::atomic<int> n_called{0};
+    for (int i = 0; i < 30; ++i) {
+      scope.spawn(
+        schedule_after(runtime.get_scheduler(), 1ms) | then([&] { ++n_called; }));
+    }
+    sync_wait(scope.on_empty());
+    CHECK(n_called == 30);
+  }
+
+  // Waits until the runtime picks the ring with the given index as the least loaded one, which
+  // happens once the rings have picked up the operations that were started on them.
+  auto eventually_picks(io_uring_runtime& runtime, std::size_t index) -> bool {
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (runtime.get_scheduler() != runtime.get_scheduler(index)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  TEST_CASE("io_uring_runtime - least loaded ring", "[io_uring][runtime]") {
+    io_uring_runtime runtime{2};
+    exec::async_scope scope;
+    for (int i = 0; i < 10; ++i) {
+      scope.spawn(schedule_after(runtime.get_scheduler(0), 10s));
+    }
+    REQUIRE(eventually_picks(runtime, 1));
+    for (int i = 0; i < 4; ++i) {
+      CHECK(runtime.get_scheduler() == runtime.get_scheduler(1));
+    }
+    for (int i = 0; i < 20; ++i) {
+      scope.spawn(schedule_after(runtime.get_scheduler(1), 10s));
+    }
+    REQUIRE(eventually_picks(runtime, 0));
+    for (int i = 0; i < 4; ++i) {
+      CHECK(runtime.get_scheduler() == runtime.get_scheduler(0));
+    }
+    scope.request_stop();
+    sync_wait(scope.on_empty());
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <linux/version.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 7, 0) && __has_include(<linux/io_uring.h>)
+
+#  include "exec/linux/io_uring_transfer_file.hpp"
+#  include "exec/single_thread_context.hpp"
+#  include "exec/when_any.hpp"
+
+#  include "catch2/catch.hpp"
+
+#  include <array>
+#  include <cstring>
+#  include <thread>
+#  include <vector>
+
+#  include <fcntl.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+using namespace stdexec;
+using namespace exec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  // An io_uring_context that is driven by a background thread.
+  struct io_thread {
+    io_uring_context context{};
+    std::thread thread{[this] { context.run_until_stopped(); }};
+
+    ~io_thread() {
+      context.request_stop();
+      thread.join();
+    }
+  };
+
+  // A temporary file with the given contents that is removed on destruction.
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-splice-XXXXXX"};
+    int fd = ::mkstemp(path.data());
+
+    explicit temp_file(const std::vector<std::byte>& contents) {
+      REQUIRE(fd >= 0);
+      REQUIRE(::write(fd, contents.data(), contents.size()) == ssize_t(contents.size()));
+    }
+
+    ~temp_file() {
+      ::close(fd);
+      ::unlink(path.data());
+    }
+  };
+
+  // A connected pair of unix stream sockets.
+  struct socket_pair {
+    std::array<int, 2> fds{-1, -1};
+
+    socket_pair() {
+      REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds.data()) == 0);
+    }
+
+    ~socket_pair() {
+      ::close(fds[0]);
+      ::close(fds[1]);
+    }
+  };
+
+  auto make_contents(std::size_t size) -> std::vector<std::byte> {
+    std::vector<std::byte> contents(size);
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<std::byte>(i % 251);
+    }
+    return contents;
+  }
+
+  // Reads up to size bytes from the socket until it is shut down.
+  auto read_all(int fd, std::size_t size) -> std::vector<std::byte> {
+    std::vector<std::byte> received(size);
+    std::size_t n_received = 0;
+    while (n_received < size) {
+      ssize_t n = ::read(fd, received.data() + n_received, size - n_received);
+      if (n <= 0) {
+        break;
+      }
+      n_received += static_cast<std::size_t>(n);
+    }
+    received.resize(n_received);
+    return received;
+  }
+
+  TEST_CASE("io_uring_transfer_file - sends a range of the file", "[io_uring][operations]") {
+    io_thread io;
+    std::vector<std::byte> contents = make_contents(1 << 20);
+    temp_file file{contents};
+    socket_pair sockets;
+    constexpr std::size_t offset = 1000;
+    constexpr std::size_t length = 700'000;
+    std::vector<std::byte> received;
+    std::thread reader{[&] { received = read_all(sockets.fds[1], length); }};
+    auto result = sync_wait(io_uring_transfer_file(
+      io.context.get_scheduler(), file.fd, sockets.fds[0], offset, length, 16 * 1024));
+    reader.join();
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == length);
+    REQUIRE(received.size() == length);
+    CHECK(std::memcmp(received.data(), contents.data() + offset, length) == 0);
+    // The file position is left alone.
+    CHECK(::lseek(file.fd, 0, SEEK_CUR) == ssize_t(contents.size()));
+  }
+
+  TEST_CASE("io_uring_transfer_file - stops at the end of the file", "[io_uring][operations]") {
+    io_thread io;
+    std::vector<std::byte> contents = make_contents(10'000);
+    temp_file file{contents};
+    socket_pair sockets;
+    auto result = sync_wait(io_uring_transfer_file(
+      io.context.get_scheduler(), file.fd, sockets.fds[0], 4'000, 1 << 20));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 6'000);
+    ::shutdown(sockets.fds[0], SHUT_WR);
+    std::vector<std::byte> received = read_all(sockets.fds[1], contents.size());
+    REQUIRE(received.size() == 6'000);
+    CHECK(std::memcmp(received.data(), contents.data() + 4'000, 6'000) == 0);
+  }
+
+  TEST_CASE("io_uring_transfer_file - reports errors", "[io_uring][operations]") {
+    io_thread io;
+    temp_file file{make_contents(100)};
+    CHECK_THROWS_AS(
+      sync_wait(io_uring_transfer_file(io.context.get_scheduler(), file.fd, -1, 0, 100)),
+      std::system_error);
+  }
+
+  TEST_CASE(
+    "io_uring_transfer_file - stop a transfer to a full socket",
+    "[io_uring][operations]") {
+    io_thread io;
+    temp_file file{make_contents(16 << 20)};
+    socket_pair sockets;
+    // Nobody reads from the socket, so the transfer blocks once the socket buffer is full.
+    auto result = sync_wait(when_any(
+      io_uring_transfer_file(io.context.get_scheduler(), file.fd, sockets.fds[0], 0, 16 << 20),
+      schedule_after(io.context.get_scheduler(), 50ms) | let_value([] { return just_stopped(); })));
+    CHECK_FALSE(result);
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#  include "exec/linux/mapped_file.hpp"
+#  include "exec/sequence/ignore_all_values.hpp"
+#  include "exec/sequence/transform_each.hpp"
+#  include "stdexec/execution.hpp"
+
+#  include <catch2/catch.hpp>
+
+#  include <array>
+#  include <cstring>
+#  include <vector>
+
+namespace {
+
+  // A temporary file with the given contents that is removed on destruction.
+  struct temp_file {
+    std::array<char, 32> path{"/tmp/stdexec-map-XXXXXX"};
+
+    explicit temp_file(const std::vector<std::byte>& contents) {
+      int fd = ::mkstemp(path.data());
+      REQUIRE(fd >= 0);
+      REQUIRE(::write(fd, contents.data(), contents.size()) == ssize_t(contents.size()));
+      ::close(fd);
+    }
+
+    ~temp_file() {
+      ::unlink(path.data());
+    }
+  };
+
+  TEST_CASE("map_file - maps the contents of a file", "[map_file]") {
+    std::vector<std::byte> contents(10'000);
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<std::byte>(i % 253);
+    }
+    temp_file file{contents};
+    exec::memory_mapped_region region = exec::map_file(file.path.data());
+    REQUIRE(region.size() == contents.size());
+    CHECK(std::memcmp(region.data(), contents.data(), contents.size()) == 0);
+  }
+
+  TEST_CASE("map_file - empty and missing files", "[map_file]") {
+    temp_file file{{}};
+    CHECK_FALSE(exec::map_file(file.path.data()));
+    CHECK_THROWS_AS(exec::map_file("/nonexistent/stdexec-map"), std::system_error);
+  }
+
+#  if STDEXEC_HAS_STD_RANGES()
+  TEST_CASE("mapped_chunks - yields page aligned chunks", "[map_file][sequence_senders]") {
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::vector<std::byte> contents(3 * page_size + page_size / 2);
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<std::byte>(i % 253);
+    }
+    temp_file file{contents};
+    exec::memory_mapped_region region = exec::map_file(file.path.data());
+    std::vector<std::span<const std::byte>> chunks;
+    stdexec::sync_wait(exec::ignore_all_values(
+      exec::mapped_chunks(region, 1)
+      | exec::transform_each(
+        stdexec::then([&](std::span<const std::byte> chunk) { chunks.push_back(chunk); }))));
+    REQUIRE(chunks.size() == 4);
+    const auto* data = static_cast<const std::byte*>(region.data());
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+      CHECK(chunks[i].data() == data + i * page_size);
+      CHECK(reinterpret_cast<std::uintptr_t>(chunks[i].data()) % page_size == 0);
+    }
+    CHECK(chunks.back().size() == page_size / 2);
+  }
+#  endif
+} // namespace
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/sharded_timed_thread_scheduler.hpp>
+
+#include "catch2/catch.hpp"
+
+#include <exec/async_scope.hpp>
+#include <exec/single_thread_context.hpp>
+#include <exec/when_any.hpp>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#if __GNUC__ > 11 || !defined(__GNUC__) || !defined(__SANITIZE_THREAD__)
+namespace {
+  TEST_CASE(
+    "sharded_timed_thread_scheduler - types",
+    "[types][sharded_timed_thread_scheduler][schedulers]") {
+    static_assert(exec::timed_scheduler<exec::sharded_timed_thread_scheduler>);
+    using target_t = decltype(std::declval<exec::single_thread_context&>().get_scheduler());
+    static_assert(
+      exec::timed_scheduler<exec::sharded_timed_thread_scheduler::targeted_scheduler<target_t>>);
+    exec::sharded_timed_thread_context context{3};
+    CHECK(context.n_shards() == 3);
+    CHECK(context.get_scheduler() == context.get_scheduler());
+  }
+
+  TEST_CASE(
+    "sharded_timed_thread_scheduler - schedule_after",
+    "[sharded_timed_thread_scheduler][schedule_at]") {
+    exec::sharded_timed_thread_context context{2};
+    exec::sharded_timed_thread_scheduler scheduler = context.get_scheduler();
+    auto start = exec::now(scheduler);
+    CHECK(stdexec::sync_wait(exec::schedule_after(scheduler, std::chrono::milliseconds(10))));
+    CHECK(exec::now(scheduler) - start >= std::chrono::milliseconds(10));
+  }
+
+  TEST_CASE(
+    "sharded_timed_thread_scheduler - producers use different shards",
+    "[sharded_timed_thread_scheduler][schedule_at]") {
+    exec::sharded_timed_thread_context context{4};
+    exec::sharded_timed_thread_scheduler scheduler = context.get_scheduler();
+    std::atomic<int> n_completed{0};
+    std::vector<std::thread> producers;
+    std::vector<std::thread::id> shard_threads(4);
+    for (std::size_t i = 0; i < 4; ++i) {
+      producers.emplace_back([&, i] {
+        exec::async_scope scope;
+        for (int j = 0; j < 100; ++j) {
+          scope.spawn(
+            exec::schedule_after(scheduler, std::chrono::microseconds(j * 10))
+            | stdexec::then([&, i] {
+                shard_threads[i] = std::this_thread::get_id();
+                ++n_completed;
+              }));
+        }
+        stdexec::sync_wait(scope.on_empty());
+      });
+    }
+    for (std::thread& producer: producers) {
+      producer.join();
+    }
+    CHECK(n_completed == 400);
+    // Four threads that use a sharded context for the first time are put on four shards.
+    CHECK(std::set<std::thread::id>(shard_threads.begin(), shard_threads.end()).size() == 4);
+  }
+
+  TEST_CASE(
+    "sharded_timed_thread_scheduler - cancel timers",
+    "[sharded_timed_thread_scheduler][when_any]") {
+    exec::sharded_timed_thread_context context{2};
+    exec::sharded_timed_thread_scheduler scheduler = context.get_scheduler();
+    for (int i = 0; i < 10; ++i) {
+      auto [n] = stdexec::sync_wait(exec::when_any(
+                                      exec::schedule_after(scheduler, std::chrono::milliseconds(1))
+                                        | stdexec::then([] { return 1; }),
+                                      exec::schedule_after(scheduler, std::chrono::hours(100))
+                                        | stdexec::then([] { return 2; })))
+                   .value();
+      CHECK(n == 1);
+    }
+  }
+
+  TEST_CASE(
+    "sharded_timed_thread_scheduler - complete on a target scheduler",
+    "[sharded_timed_thread_scheduler][schedule_at]") {
+    exec::sharded_timed_thread_context context{2};
+    exec::single_thread_context target;
+    auto scheduler = context.get_scheduler().completing_on(target.get_scheduler());
+    auto [id] = stdexec::sync_wait(
+                  exec::schedule_after(scheduler, std::chrono::milliseconds(1))
+                  | stdexec::then([] { return std::this_thread::get_id(); }))
+                  .value();
+    CHECK(id == target.get_thread_id());
+  }
+} // namespace
+#endif
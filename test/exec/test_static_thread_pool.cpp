@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/async_scope.hpp"
+#include "exec/static_thread_pool.hpp"
+#include "stdexec/execution.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace stdexec;
+using namespace std::chrono_literals;
+
+namespace {
+
+  TEST_CASE(
+    "static_thread_pool - enqueue batches are handed over when they end",
+    "[types][static_thread_pool]") {
+    exec::static_thread_pool pool{2};
+    exec::async_scope scope;
+    std::atomic<int> n_done{0};
+    pool.begin_enqueue_batch();
+    for (int i = 0; i < 16; ++i) {
+      scope.spawn(schedule(pool.get_scheduler()) | then([&] { ++n_done; }));
+    }
+    std::this_thread::sleep_for(10ms);
+    CHECK(n_done == 0);
+    pool.end_enqueue_batch();
+    sync_wait(scope.on_empty());
+    CHECK(n_done == 16);
+  }
+
+  TEST_CASE(
+    "static_thread_pool - full enqueue batches are handed over",
+    "[types][static_thread_pool]") {
+    exec::static_thread_pool pool{2};
+    exec::async_scope scope;
+    std::atomic<int> n_done{0};
+    constexpr int max_size = static_cast<int>(exec::static_thread_pool::max_enqueue_batch_size);
+    pool.begin_enqueue_batch();
+    for (int i = 0; i < max_size + 1; ++i) {
+      scope.spawn(schedule(pool.get_scheduler()) | then([&] { ++n_done; }));
+    }
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (n_done < max_size && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    CHECK(n_done == max_size);
+    pool.end_enqueue_batch();
+    sync_wait(scope.on_empty());
+    CHECK(n_done == max_size + 1);
+  }
+
+  TEST_CASE(
+    "static_thread_pool - beginning a batch flushes the batch of another pool",
+    "[types][static_thread_pool]") {
+    exec::static_thread_pool pool1{1};
+    exec::static_thread_pool pool2{1};
+    exec::async_scope scope;
+    std::atomic<bool> done{false};
+    pool1.begin_enqueue_batch();
+    scope.spawn(schedule(pool1.get_scheduler()) | then([&] { done = true; }));
+    pool2.begin_enqueue_batch();
+    sync_wait(scope.on_empty());
+    CHECK(done);
+    pool2.end_enqueue_batch();
+    // Ending a batch that is not open does nothing.
+    pool1.end_enqueue_batch();
+  }
+} // namespace
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <span>
 #include <thread>
 #include <iostream>
 #include <chrono>
@@ -27,6 +31,12 @@
 #include <exec/static_thread_pool.hpp>
 #include <exec/system_context.hpp>
 
+#if STDEXEC_SYSTEM_CONTEXT_IO_URING
+#  include <exec/linux/io_uring_operations.hpp>
+
+#  include <unistd.h>
+#endif
+
 #include <catch2/catch.hpp>
 #include <test_common/receivers.hpp>
 
@@ -237,6 +247,108 @@ TEST_CASE("simple bulk chaining on system context", "[types][system_scheduler]")
   CHECK(std::get<0>(res.value()) == pool_id);
 }
 
+TEST_CASE("bulk on system context runs each item exactly once", "[types][system_scheduler]") {
+  // An odd size, so that the items do not divide evenly into chunks.
+  constexpr size_t num_tasks = 1001;
+  std::atomic<int> counts[num_tasks]{};
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+
+  auto bulk_snd = ex::bulk(ex::schedule(sched), num_tasks, [&](unsigned long id) {
+    counts[id].fetch_add(1, std::memory_order_relaxed);
+  });
+
+  ex::sync_wait(std::move(bulk_snd));
+
+  for (size_t i = 0; i < num_tasks; ++i) {
+    REQUIRE(counts[i].load() == 1);
+  }
+}
+
+struct my_io_context {
+  int value = 0;
+};
+
+struct my_other_io_context { };
+
+template <>
+struct exec::system_context_replaceability::io_context_identifier<my_io_context> {
+  static constexpr __uuid value{0x0123456789abcdef, 0x1};
+};
+
+template <>
+struct exec::system_context_replaceability::io_context_identifier<my_other_io_context> {
+  static constexpr __uuid value{0x0123456789abcdef, 0x2};
+};
+
+#if STDEXEC_SYSTEM_CONTEXT_IO_URING
+TEST_CASE("system scheduler provides the system io_uring context", "[types][system_scheduler]") {
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+  auto* io = exec::get_system_io_context<exec::io_uring_context>(sched);
+  if (io == nullptr) {
+    WARN("io_uring is not usable here; the default backend has no system io context");
+    return;
+  }
+  REQUIRE(exec::get_system_io_context<exec::io_uring_context>(sched) == io);
+  REQUIRE(exec::get_system_io_context<my_io_context>(sched) == nullptr);
+
+  int pipe_fds[2];
+  REQUIRE(::pipe(pipe_fds) == 0);
+  std::array<std::byte, 5> buffer{};
+  std::thread::id io_thread_id{};
+  auto written = ex::sync_wait(exec::io_uring_write(
+    io->get_scheduler(), pipe_fds[1], std::as_bytes(std::span{"hello", 5}), -1));
+  auto read = ex::sync_wait(
+    exec::io_uring_read(io->get_scheduler(), pipe_fds[0], buffer, -1)
+    | ex::then([&](std::size_t n) {
+        io_thread_id = std::this_thread::get_id();
+        return n;
+      }));
+  ::close(pipe_fds[0]);
+  ::close(pipe_fds[1]);
+
+  REQUIRE(written);
+  CHECK(std::get<0>(*written) == 5);
+  REQUIRE(read);
+  CHECK(std::get<0>(*read) == 5);
+  CHECK(std::memcmp(buffer.data(), "hello", 5) == 0);
+  CHECK(io_thread_id != std::this_thread::get_id());
+}
+#endif
+
+struct my_system_io_context_impl : exec::system_context_replaceability::system_io_context {
+  __uuid io_context_id() const noexcept override {
+    return exec::system_context_replaceability::io_context_identifier<my_io_context>::value;
+  }
+
+  void* get_io_context() noexcept override {
+    return &context_;
+  }
+
+  my_io_context context_{};
+};
+
+TEST_CASE("can change the io backend of system context", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+
+  my_system_io_context_impl my_io;
+  auto scr = query_system_context<__system_context_replaceability>();
+  scr->__set_system_io_context(&my_io);
+
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+  REQUIRE(exec::get_system_io_context<my_io_context>(sched) == &my_io.context_);
+  REQUIRE(exec::get_system_io_context<my_io_context>(sched.with_hints({.cpu = 0}))
+          == &my_io.context_);
+  REQUIRE(exec::get_system_io_context<my_other_io_context>(sched) == nullptr);
+  STATIC_REQUIRE_FALSE(std::invocable<exec::get_system_io_context_t<int>, exec::system_scheduler>);
+
+  scr->__set_system_io_context(nullptr);
+  REQUIRE(query_system_context<system_io_context>() == nullptr);
+  REQUIRE(exec::get_system_io_context<my_io_context>(sched) == nullptr);
+}
+
 struct my_system_scheduler_impl : exec::__system_context_default_impl::__system_scheduler_impl {
   using base_t = exec::__system_context_default_impl::__system_scheduler_impl;
 
@@ -265,6 +377,9 @@ TEST_CASE("can change the implementation of system context", "[types][system_sch
   my_system_scheduler_impl my_scheduler;
   auto scr = query_system_context<__system_context_replaceability>();
   scr->__set_system_scheduler(&my_scheduler);
+  // Set without its optional interfaces, the backend takes no hints.
+  REQUIRE(query_system_context<system_scheduler_with_hints>() == nullptr);
+  REQUIRE(query_system_context<system_scheduler_storage>() == nullptr);
 
   std::thread::id this_id = std::this_thread::get_id();
   std::thread::id pool_id{};
@@ -280,3 +395,189 @@ TEST_CASE("can change the implementation of system context", "[types][system_sch
   REQUIRE(pool_id != std::thread::id{});
   REQUIRE(this_id != pool_id);
 }
+
+struct item_by_item_system_scheduler_impl
+  : exec::__system_context_default_impl::__system_scheduler_impl {
+  // Hands out the items one at a time on the calling thread, instead of in chunks.
+  void bulk_schedule(
+    uint32_t __n,
+    exec::__system_context_default_impl::storage,
+    exec::__system_context_default_impl::bulk_item_receiver* __r) noexcept override {
+    for (uint32_t __i = 0; __i < __n; ++__i) {
+      __r->start(__i);
+    }
+    __r->set_value();
+  }
+};
+
+TEST_CASE("system context backends can run bulk items one by one", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+
+  item_by_item_system_scheduler_impl my_scheduler;
+  auto scr = query_system_context<__system_context_replaceability>();
+  scr->__set_system_scheduler(&my_scheduler);
+
+  constexpr size_t num_tasks = 16;
+  int counts[num_tasks]{};
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+
+  auto snd = ex::then(ex::schedule(sched), [] { return 3; });
+  auto bulk_snd = ex::bulk(
+    std::move(snd), num_tasks, [&](unsigned long id, int value) { counts[id] += value; });
+  auto res = ex::sync_wait(std::move(bulk_snd));
+
+  REQUIRE(res.has_value());
+  for (size_t i = 0; i < num_tasks; ++i) {
+    REQUIRE(counts[i] == 3);
+  }
+}
+
+struct hints_recording_system_scheduler_impl
+  : exec::__system_context_default_impl::__system_scheduler_impl {
+  using base_t = exec::__system_context_default_impl::__system_scheduler_impl;
+  using base_t::schedule;
+  using base_t::bulk_schedule;
+
+  void schedule(
+    exec::__system_context_default_impl::storage __s,
+    exec::__system_context_default_impl::receiver* __r,
+    const exec::schedule_hints& __h) noexcept override {
+    num_hinted_schedules++;
+    last_hints = __h;
+    base_t::schedule(__s, __r, __h);
+  }
+
+  void bulk_schedule(
+    uint32_t __n,
+    exec::__system_context_default_impl::storage __s,
+    exec::__system_context_default_impl::bulk_item_receiver* __r,
+    const exec::schedule_hints& __h) noexcept override {
+    num_hinted_bulk_schedules++;
+    base_t::bulk_schedule(__n, __s, __r, __h);
+  }
+
+  std::atomic<int> num_hinted_schedules{0};
+  std::atomic<int> num_hinted_bulk_schedules{0};
+  exec::schedule_hints last_hints{};
+};
+
+TEST_CASE("system scheduler passes its hints to the backend", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+
+  hints_recording_system_scheduler_impl my_scheduler;
+  auto scr = query_system_context<__system_context_replaceability>();
+  scr->__set_system_scheduler(&my_scheduler, &my_scheduler, &my_scheduler);
+
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+  const exec::schedule_hints hints{
+    .priority = exec::schedule_hints::priority_level::high, .latency_sensitive = true};
+  exec::system_scheduler hinted_sched = sched.with_hints(hints);
+
+  REQUIRE(sched.hints() == exec::schedule_hints{});
+  REQUIRE(hinted_sched.hints() == hints);
+  REQUIRE(hinted_sched != sched);
+
+  // Work without hints does not use the interface with hints.
+  ex::sync_wait(ex::schedule(sched));
+  REQUIRE(my_scheduler.num_hinted_schedules == 0);
+
+  ex::sync_wait(ex::schedule(hinted_sched));
+  REQUIRE(my_scheduler.num_hinted_schedules == 1);
+  REQUIRE(my_scheduler.last_hints == hints);
+
+  // The completion scheduler keeps the hints, so bulk work gets them too.
+  constexpr size_t num_tasks = 100;
+  std::atomic<int> counts[num_tasks]{};
+  ex::sync_wait(ex::bulk(ex::schedule(hinted_sched), num_tasks, [&](unsigned long id) {
+    counts[id].fetch_add(1, std::memory_order_relaxed);
+  }));
+  REQUIRE(my_scheduler.num_hinted_bulk_schedules == 1);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    REQUIRE(counts[i].load() == 1);
+  }
+}
+
+TEST_CASE("system scheduler runs work pinned to a cpu on one thread", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+
+  exec::__system_context_default_impl::__system_scheduler_impl my_scheduler;
+  auto scr = query_system_context<__system_context_replaceability>();
+  scr->__set_system_scheduler(&my_scheduler, &my_scheduler, &my_scheduler);
+
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler().with_hints({.cpu = 0});
+  auto get_id = [] {
+    return std::this_thread::get_id();
+  };
+
+  auto [pinned_id] = ex::sync_wait(ex::then(ex::schedule(sched), get_id)).value();
+  REQUIRE(pinned_id != std::this_thread::get_id());
+  for (int i = 0; i < 10; ++i) {
+    auto [id] = ex::sync_wait(ex::then(ex::schedule(sched), get_id)).value();
+    REQUIRE(id == pinned_id);
+  }
+
+  constexpr size_t num_tasks = 16;
+  std::thread::id pool_ids[num_tasks];
+  ex::sync_wait(ex::bulk(ex::schedule(sched), num_tasks, [&](unsigned long id) {
+    pool_ids[id] = std::this_thread::get_id();
+  }));
+  for (size_t i = 0; i < num_tasks; ++i) {
+    REQUIRE(pool_ids[i] == pinned_id);
+  }
+}
+
+TEST_CASE("system scheduler runs urgent work first", "[types][system_scheduler]") {
+  using namespace exec::system_context_replaceability;
+  using priority = exec::schedule_hints::priority_level;
+
+  exec::__system_context_default_impl::__system_scheduler_impl my_scheduler;
+  auto scr = query_system_context<__system_context_replaceability>();
+  scr->__set_system_scheduler(&my_scheduler, &my_scheduler, &my_scheduler);
+
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+  exec::async_scope scope;
+
+  // Occupy every thread of the backend, so that the work below has to wait in its queues.
+  const int num_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  std::atomic<int> num_blocked{0};
+  std::atomic<bool> release{false};
+  for (int i = 0; i < num_threads; ++i) {
+    scope.spawn(ex::then(ex::schedule(sched.with_hints({.cpu = i})), [&] {
+      num_blocked.fetch_add(1);
+      release.wait(false);
+    }));
+  }
+  while (num_blocked.load() < num_threads) {
+    std::this_thread::yield();
+  }
+
+  constexpr int num_items = 64;
+  std::atomic<int> next{0};
+  int low_order[num_items]{};
+  int high_order[num_items]{};
+  for (int i = 0; i < num_items; ++i) {
+    scope.spawn(ex::then(ex::schedule(sched.with_hints({.priority = priority::low})), [&, i] {
+      low_order[i] = next.fetch_add(1);
+    }));
+  }
+  for (int i = 0; i < num_items; ++i) {
+    scope.spawn(ex::then(ex::schedule(sched.with_hints({.priority = priority::high})), [&, i] {
+      high_order[i] = next.fetch_add(1);
+    }));
+  }
+  release = true;
+  release.notify_all();
+  ex::sync_wait(scope.on_empty());
+
+  // All threads take work from the queues at the same time, so some low priority work may
+  // overtake high priority work that was taken just before it.
+  int num_high_first = 0;
+  for (int i = 0; i < num_items; ++i) {
+    num_high_first += high_order[i] < num_items ? 1 : 0;
+  }
+  REQUIRE(num_high_first > num_items / 2);
+}
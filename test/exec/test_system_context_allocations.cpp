@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replaces the global allocation functions to count allocations, so this test is built as an
+// executable of its own.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#define STDEXEC_SYSTEM_CONTEXT_HEADER_ONLY 1
+
+#include <catch2/catch.hpp>
+#include <stdexec/execution.hpp>
+#include <exec/system_context.hpp>
+
+namespace ex = stdexec;
+
+namespace {
+  std::atomic<bool> counting{false};
+  std::atomic<int> num_allocations{0};
+
+  void* counted_allocate(std::size_t size, std::size_t alignment) {
+    if (counting.load(std::memory_order_relaxed)) {
+      num_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    size = (size + alignment - 1) / alignment * alignment;
+    if (void* p = std::aligned_alloc(alignment, size == 0 ? alignment : size)) {
+      return p;
+    }
+    throw std::bad_alloc{};
+  }
+
+  /// Counts the allocations made while running `fun`.
+  template <class Fun>
+  int allocations_of(Fun fun) {
+    num_allocations = 0;
+    counting = true;
+    fun();
+    counting = false;
+    return num_allocations.load();
+  }
+} // namespace
+
+void* operator new(std::size_t size) {
+  return counted_allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return counted_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+TEST_CASE("system context backend publishes its storage needs", "[system_scheduler][allocations]") {
+  using namespace exec::system_context_replaceability;
+  auto* backend_storage = query_system_context<system_scheduler_storage>();
+  REQUIRE(backend_storage != nullptr);
+
+  for (storage_requirements req: {
+         backend_storage->schedule_storage(), backend_storage->bulk_schedule_storage()}) {
+    CHECK(req.__size > 0);
+    CHECK(req.__alignment > 0);
+    CHECK((req.__alignment & (req.__alignment - 1)) == 0);
+  }
+
+  // The frontend provides enough storage for the default backend.
+  CHECK(backend_storage->schedule_storage().__size <= STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_SIZE);
+  CHECK(
+    backend_storage->schedule_storage().__alignment <= STDEXEC_SYSTEM_CONTEXT_SCHEDULE_OP_ALIGN);
+  CHECK(
+    backend_storage->bulk_schedule_storage().__size
+    <= STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_SIZE);
+  CHECK(
+    backend_storage->bulk_schedule_storage().__alignment
+    <= STDEXEC_SYSTEM_CONTEXT_BULK_SCHEDULE_OP_ALIGN);
+}
+
+TEST_CASE("system scheduler operations do not allocate", "[system_scheduler][allocations]") {
+  exec::system_context ctx;
+  exec::system_scheduler sched = ctx.get_scheduler();
+  exec::system_scheduler hinted_sched =
+    sched.with_hints({.priority = exec::schedule_hints::priority_level::high});
+  std::atomic<int> count{0};
+  auto run_all = [&] {
+    ex::sync_wait(ex::schedule(sched));
+    ex::sync_wait(ex::schedule(hinted_sched));
+    ex::sync_wait(ex::bulk(ex::schedule(sched), 100, [&](unsigned long) { ++count; }));
+    ex::sync_wait(ex::bulk(ex::schedule(hinted_sched), 100, [&](unsigned long) { ++count; }));
+  };
+
+  // Operations that do not fit in the storage of the frontend take blocks from the backend,
+  // which allocates them when they are first needed.
+  run_all();
+
+  for (int i = 0; i < 10; ++i) {
+    REQUIRE(allocations_of(run_all) == 0);
+  }
+  REQUIRE(count == 11 * 200);
+}
@@ -22,6 +22,9 @@
 #include <exec/async_scope.hpp>
 #include <exec/when_any.hpp>
 
+#include <optional>
+#include <vector>
+
 #if __GNUC__ > 11 || !defined(__GNUC__) || !defined(__SANITIZE_THREAD__)
 namespace {
   TEST_CASE(
@@ -118,5 +121,144 @@ namespace {
     auto duration = t1 - t0;
     CHECK(duration > std::chrono::milliseconds(100));
   }
+
+  TEST_CASE(
+    "timed_thread_scheduler - timing wheel",
+    "[timed_thread_scheduler][schedule_at][wheel]") {
+    exec::timed_thread_context context{exec::timed_thread_context_options{
+      .timer_store = exec::timed_thread_timer_store::wheel,
+      .wheel_resolution = std::chrono::microseconds(10)}};
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    // With a resolution of 10us the deadlines span several levels of the wheel.
+    std::vector<int> order;
+    int n_early = 0;
+    auto now = exec::now(scheduler);
+    for (int i : {7, 2, 9, 0, 5, 3, 8, 1, 6, 4}) {
+      auto deadline = now + std::chrono::milliseconds(5) * i;
+      scope.spawn(
+        exec::schedule_at(scheduler, deadline) | stdexec::then([&order, &n_early, deadline, i] {
+          n_early += std::chrono::steady_clock::now() < deadline;
+          order.push_back(i);
+        }));
+    }
+    CHECK(stdexec::sync_wait(scope.on_empty()));
+    CHECK(n_early == 0);
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  }
+
+  TEST_CASE(
+    "timed_thread_scheduler - cancel timers in a timing wheel",
+    "[timed_thread_scheduler][when_any][wheel]") {
+    exec::timed_thread_context context{
+      exec::timed_thread_context_options{.timer_store = exec::timed_thread_timer_store::wheel}};
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    for (int i = 0; i < 100; ++i) {
+      auto [n] = stdexec::sync_wait(exec::when_any(
+                                      exec::schedule_after(scheduler, std::chrono::milliseconds(1))
+                                        | stdexec::then([] { return 1; }),
+                                      exec::schedule_after(scheduler, std::chrono::hours(100))
+                                        | stdexec::then([] { return 2; })))
+                   .value();
+      CHECK(n == 1);
+    }
+  }
+
+  TEST_CASE(
+    "timed_thread_scheduler - stop a context with a timing wheel",
+    "[timed_thread_scheduler][wheel]") {
+    std::optional<exec::timed_thread_context> context{};
+    context.emplace(
+      exec::timed_thread_context_options{.timer_store = exec::timed_thread_timer_store::wheel});
+    exec::timed_thread_scheduler scheduler = context->get_scheduler();
+    exec::async_scope scope;
+    int n_stopped = 0;
+    for (int i = 1; i <= 10; ++i) {
+      scope.spawn(
+        exec::schedule_after(scheduler, std::chrono::seconds(10) * i)
+        | stdexec::let_stopped([&n_stopped] {
+            ++n_stopped;
+            return stdexec::just();
+          }));
+    }
+    context.reset();
+    CHECK(stdexec::sync_wait(scope.on_empty()));
+    CHECK(n_stopped == 10);
+  }
+
+  TEST_CASE(
+    "timed_thread_scheduler - d-ary heap",
+    "[timed_thread_scheduler][schedule_at][dary_heap]") {
+    exec::timed_thread_context context{
+      exec::timed_thread_context_options{.timer_store = exec::timed_thread_timer_store::dary_heap}};
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    exec::async_scope scope;
+    std::vector<int> order;
+    auto now = exec::now(scheduler);
+    for (int i : {7, 2, 9, 0, 5, 3, 8, 1, 6, 4}) {
+      scope.spawn(
+        exec::when_any(
+          exec::schedule_at(scheduler, now + std::chrono::milliseconds(2) * i),
+          exec::schedule_after(scheduler, std::chrono::hours(100)))
+        | stdexec::then([&order, i] { order.push_back(i); }));
+    }
+    CHECK(stdexec::sync_wait(scope.on_empty()));
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  }
+
+  TEST_CASE(
+    "timed_thread_scheduler - timers within the slack complete together",
+    "[timed_thread_scheduler][schedule_at][slack]") {
+    exec::timed_thread_context context{
+      exec::timed_thread_context_options{.timer_slack = std::chrono::milliseconds(50)}};
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    CHECK(scheduler.slack() == std::chrono::milliseconds(50));
+    exec::async_scope scope;
+    std::vector<int> order;
+    std::vector<std::chrono::steady_clock::time_point> completed_at;
+    auto now = exec::now(scheduler);
+    for (int i : {7, 2, 9, 0, 5, 3, 8, 1, 6, 4}) {
+      auto deadline = now + std::chrono::milliseconds(20 + i);
+      scope.spawn(
+        exec::schedule_at(scheduler, deadline) | stdexec::then([&order, &completed_at, i] {
+          completed_at.push_back(std::chrono::steady_clock::now());
+          order.push_back(i);
+        }));
+    }
+    CHECK(stdexec::sync_wait(scope.on_empty()));
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    // The context thread wakes up once, at the latest completion time of the first timer.
+    for (auto tp: completed_at) {
+      CHECK(tp >= now + std::chrono::milliseconds(70));
+    }
+  }
+
+  TEST_CASE(
+    "timed_thread_scheduler - per-timer slack",
+    "[timed_thread_scheduler][schedule_at][slack]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    exec::timed_thread_scheduler lenient = scheduler.with_slack(std::chrono::milliseconds(30));
+    CHECK(scheduler.slack() == std::chrono::steady_clock::duration::zero());
+    CHECK(lenient.slack() == std::chrono::milliseconds(30));
+    exec::async_scope scope;
+    std::vector<int> order;
+    int n_early = 0;
+    auto now = exec::now(scheduler);
+    auto spawn = [&](exec::timed_thread_scheduler sched, auto deadline, int i) {
+      scope.spawn(
+        exec::schedule_at(sched, deadline) | stdexec::then([&order, &n_early, deadline, i] {
+          n_early += std::chrono::steady_clock::now() < deadline;
+          order.push_back(i);
+        }));
+    };
+    // The first timer may complete as late as the second one, so both complete in the wake-up
+    // for the second timer.
+    spawn(lenient, now + std::chrono::milliseconds(10), 1);
+    spawn(scheduler, now + std::chrono::milliseconds(20), 2);
+    CHECK(stdexec::sync_wait(scope.on_empty()));
+    CHECK(n_early == 0);
+    CHECK(order == std::vector<int>{2, 1});
+  }
 } // namespace
 #endif
\ No newline at end of file
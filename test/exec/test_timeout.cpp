@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/timeout.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+
+#include "catch2/catch.hpp"
+
+#include <system_error>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+  TEST_CASE("timeout - completes before the timeout", "[timeout]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    auto result = stdexec::sync_wait(exec::timeout(
+      stdexec::schedule(scheduler) | stdexec::then([] { return 42; }), scheduler, 10s));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 42);
+  }
+
+  TEST_CASE("timeout - reports a sender that times out", "[timeout]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    auto start = exec::now(scheduler);
+    std::error_code error{};
+    try {
+      stdexec::sync_wait(exec::timeout(exec::schedule_at(scheduler, start + 10s), scheduler, 10ms));
+    } catch (const std::system_error& e) {
+      error = e.code();
+    }
+    CHECK(error == std::errc::timed_out);
+    CHECK(exec::now(scheduler) - start < 10s);
+  }
+
+  TEST_CASE("timeout - cancels the timer on the thread of the sender", "[timeout]") {
+    exec::timed_thread_context timers;
+    exec::timed_thread_context work;
+    // The timer is in the store of timers long before the sender completes, so that cancelling
+    // it does not involve the thread of timers.
+    auto [id] = stdexec::sync_wait(
+                  exec::timeout(
+                    exec::schedule_after(work.get_scheduler(), 20ms), timers.get_scheduler(), 10s)
+                  | stdexec::then([] { return std::this_thread::get_id(); }))
+                  .value();
+    auto work_id = stdexec::sync_wait(
+                     stdexec::schedule(work.get_scheduler())
+                     | stdexec::then([] { return std::this_thread::get_id(); }))
+                     .value();
+    CHECK(id == std::get<0>(work_id));
+  }
+} // namespace
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <exec/with_deadline.hpp>
+#include <exec/timed_thread_scheduler.hpp>
+
+#include "catch2/catch.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+  TEST_CASE("with_deadline - completes before the deadline", "[with_deadline]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    auto result = stdexec::sync_wait(
+      exec::with_deadline(stdexec::schedule(scheduler) | stdexec::then([] { return 42; }), 10s));
+    REQUIRE(result);
+    CHECK(std::get<0>(*result) == 42);
+  }
+
+  TEST_CASE("with_deadline - stops a sender that misses the deadline", "[with_deadline]") {
+    exec::timed_thread_context context;
+    exec::timed_thread_scheduler scheduler = context.get_scheduler();
+    auto start = exec::now(scheduler);
+    auto result =
+      stdexec::sync_wait(exec::with_deadline(exec::schedule_at(scheduler, start + 10s), 10ms));
+    CHECK_FALSE(result);
+    CHECK(exec::now(scheduler) - start < 10s);
+  }
+} // namespace